@@ -0,0 +1,14 @@
+a = list(range(100000))
+b = [i * 0.5 for i in a]
+
+n = 0
+for _ in range(20):
+    n += sum(map(lambda x: x + 1, filter(lambda x: x % 3, a)))
+    for i, t in enumerate(zip(a, b)):
+        n += i
+    for x in reversed(a):
+        n += x
+    n += sum(a) + max(a) - min(a)
+    n += int(sum(b) + max(b) - min(b))
+
+assert n == 416666166620
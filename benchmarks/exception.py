@@ -0,0 +1,29 @@
+def f(i):
+    if i % 2 == 0:
+        raise ValueError(i)
+    return i
+
+def g(i):
+    return f(i)
+
+n = 0
+for i in range(1000000):
+    try:
+        raise KeyError(i)
+    except KeyError:
+        n += 1
+
+for i in range(1000000):
+    try:
+        g(i)
+    except ValueError:
+        n += 1
+
+d = {}
+for i in range(200000):
+    try:
+        d[i]
+    except KeyError:
+        n += 1
+
+assert n == 1700000
@@ -0,0 +1,23 @@
+def source(n):
+    a, b, c, d = 0, 1, 2, 3
+    for i in range(n):
+        yield i + a + b + c + d - 6
+
+def square(it):
+    for i in it:
+        yield i * i
+
+def evens(it):
+    for i in it:
+        if i % 2 == 0:
+            yield i
+
+def halve(it):
+    for i in it:
+        yield i // 2
+
+n = 0
+for i in halve(evens(square(source(1000000)))):
+    n += i
+
+assert n == 83333083333500000
@@ -2,21 +2,20 @@ import random
 
 a = [random.randint(-100000, 100000) for i in range(100000)]
 
-def __qsort(a: list, L: int, R: int):
-    if L >= R: return;
-    mid = a[(R+L)//2];
-    i, j = L, R
-    while i<=j:
-        while a[i]<mid: i+=1
-        while a[j]>mid: j-=1
-        if i<=j:
-            a[i], a[j] = a[j], a[i]
-            i+=1
-            j-=1
-    __qsort(a, L, j)
-    __qsort(a, i, R)
+# random ints
+b = sorted(a)
+for i in range(1, len(b)):
+    assert b[i-1] <= b[i]
 
-from dis import dis
-# dis(__qsort)
+# pre-sorted and reversed input
+c = sorted(b)
+assert c == b
+c = sorted(b, reverse=True)
+assert c[0] == b[-1] and c[-1] == b[0]
 
-__qsort(a, 0, len(a)-1)
\ No newline at end of file
+# floats, strings and a key function
+b = sorted([x * 0.5 for x in a])
+assert b[0] == min(a) * 0.5
+b = sorted([str(x) for x in a[:20000]])
+b = sorted(a, key=lambda x: -x)
+assert b[0] == max(a)
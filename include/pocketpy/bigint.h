@@ -0,0 +1,91 @@
+#pragma once
+
+#include "common.h"
+
+namespace pkpy{
+
+// returns true if `a + b` overflows, the result is stored in `out` anyway
+inline bool i64_add_overflow(i64 a, i64 b, i64* out){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(a, b, out);
+#else
+    *out = (i64)((uint64_t)a + (uint64_t)b);
+    return (a >= 0) == (b >= 0) && (*out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool i64_sub_overflow(i64 a, i64 b, i64* out){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(a, b, out);
+#else
+    *out = (i64)((uint64_t)a - (uint64_t)b);
+    return (a >= 0) != (b >= 0) && (*out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool i64_mul_overflow(i64 a, i64 b, i64* out){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(a, b, out);
+#else
+    *out = (i64)((uint64_t)a * (uint64_t)b);
+    if(a == 0 || b == 0) return false;
+    if(a == -1) return b == INT64_MIN;
+    if(b == -1) return a == INT64_MIN;
+    return *out / a != b;
+#endif
+}
+
+// An arbitrary-precision integer in sign-magnitude form.
+// The magnitude is stored in 32-bit limbs, least significant first,
+// so a limb product and its carries always fit in 64 bits.
+struct BigInt{
+    using limb_t = uint32_t;
+    static constexpr int kLimbBits = 32;
+    // operands with fewer limbs are multiplied by the schoolbook method
+    static constexpr int kKaratsubaThreshold = 40;
+
+    bool neg = false;
+    std::vector<limb_t> d;      // no leading zero limbs, zero is empty
+
+    BigInt() = default;
+    BigInt(i64 value);
+
+    static BigInt from_f64(f64 value);
+    // parses an optional sign, decimal digits and an optional `L` suffix
+    static bool from_str(std::string_view s, BigInt& out);
+
+    bool is_zero() const { return d.empty(); }
+    bool is_odd() const { return !d.empty() && (d[0] & 1); }
+    bool to_i64(i64* out) const;
+    f64 to_f64() const;
+    std::string to_string() const;
+    i64 hash() const;
+    i64 bit_length() const;
+
+    int cmp(const BigInt& other) const;
+    bool operator==(const BigInt& other) const { return neg == other.neg && d == other.d; }
+
+    BigInt operator-() const;
+    BigInt abs() const;
+    BigInt operator+(const BigInt& other) const;
+    BigInt operator-(const BigInt& other) const;
+    BigInt operator*(const BigInt& other) const;
+    // floor division, the remainder has the sign of `b` like in python
+    static void divmod(const BigInt& a, const BigInt& b, BigInt& q, BigInt& r);
+    BigInt pow(i64 exp) const;
+    static BigInt pow_mod(const BigInt& base, const BigInt& exp, const BigInt& mod);
+
+    BigInt operator<<(i64 n) const;
+    BigInt operator>>(i64 n) const;     // rounds towards negative infinity
+    BigInt operator&(const BigInt& other) const;
+    BigInt operator|(const BigInt& other) const;
+    BigInt operator^(const BigInt& other) const;
+    BigInt operator~() const;
+
+    void _trim(){
+        while(!d.empty() && d.back() == 0) d.pop_back();
+        if(d.empty()) neg = false;
+    }
+};
+
+}   // namespace pkpy
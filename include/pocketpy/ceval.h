@@ -1,4 +1,5 @@
 #pragma once
 
 #include "vm.h"
+#include "iter.h"
 // dummy header for ceval.cpp
\ No newline at end of file
@@ -23,6 +23,8 @@ struct Bytecode{
     uint16_t op;
     uint16_t block;
     int arg;
+
+    Bytecode generic() const;   // undo quickening
 };
 
 enum CodeBlockType {
@@ -36,6 +38,22 @@ enum CodeBlockType {
 inline const int BC_NOARG = -1;
 inline const int BC_KEEPLINE = -1;
 
+enum AttrCacheKind {
+    ATTR_CACHE_INSTANCE,    // not found in mro, only look up the instance __dict__
+    ATTR_CACHE_PROPERTY,    // data descriptor
+    ATTR_CACHE_METHOD,      // function or native function
+    ATTR_CACHE_CLASS_VAR,   // other class attributes
+};
+
+// inline cache for LOAD_ATTR, LOAD_METHOD and STORE_ATTR
+// valid only if the receiver's type and its version are unchanged
+struct AttrCache{
+    PyObject* cls_var = nullptr;
+    Type type;
+    unsigned int version = 0;
+    AttrCacheKind kind = ATTR_CACHE_INSTANCE;
+};
+
 struct CodeBlock {
     CodeBlockType type;
     int parent;         // parent index in blocks
@@ -53,6 +71,11 @@ struct CodeBlock {
     }
 };
 
+struct FreeVar {
+    int index;          // index in co->varnames
+    int source;         // index in varnames of the enclosing function, whose slot holds the cell
+};
+
 struct CodeObject;
 struct FuncDecl;
 using CodeObject_ = std::shared_ptr<CodeObject>;
@@ -83,7 +106,7 @@ struct CodeObjectSerializer{
         static_assert(std::is_trivially_copyable<T>::value);
         buffer += 'x';
         char* p = (char*)&v;
-        for(int i=0; i<sizeof(T); i++){
+        for(int i=0; i<(int)sizeof(T); i++){
             char c = p[i];
             buffer += "0123456789abcdef"[(c >> 4) & 0xf];
             buffer += "0123456789abcdef"[c & 0xf];
@@ -96,6 +119,55 @@ struct CodeObjectSerializer{
     std::string str();
 };
 
+// compact binary format of the bytecode cache, see `CodeObject::dump()`
+// names are written as indices of a names table, since `StrName` indices differ between processes
+struct CodeObjectWriter{
+    VM* vm;
+    std::string buffer;
+    std::map<StrName, int> name_ids;
+    std::vector<StrName> names;
+
+    CodeObjectWriter(VM* vm): vm(vm) {}
+
+    template<typename T>
+    void write(T v){
+        static_assert(std::is_trivially_copyable<T>::value);
+        buffer.append((const char*)&v, sizeof(T));
+    }
+
+    void write_str(std::string_view sv);
+    void write_name(StrName name);
+    void write_object(PyObject* obj);
+    void write_code(const CodeObject* co);
+};
+
+struct CodeObjectReader{
+    VM* vm;
+    const char* p;
+    const char* end;
+    std::vector<StrName> names;
+    std::shared_ptr<SourceData> src;
+
+    CodeObjectReader(VM* vm, const char* p, const char* end, std::shared_ptr<SourceData> src):
+        vm(vm), p(p), end(end), src(src) {}
+
+    // throws `std::runtime_error` if the data is truncated
+    template<typename T>
+    T read(){
+        static_assert(std::is_trivially_copyable<T>::value);
+        if(end - p < (int)sizeof(T)) throw std::runtime_error("truncated bytecode");
+        T v;
+        memcpy(&v, p, sizeof(T));
+        p += sizeof(T);
+        return v;
+    }
+
+    Str read_str();
+    StrName read_name();
+    PyObject* read_object();
+    CodeObject_ read_code();
+};
+
 
 struct CodeObject {
     std::shared_ptr<SourceData> src;
@@ -107,14 +179,25 @@ struct CodeObject {
     List consts;
     std::vector<StrName> varnames;      // local variables
     NameDictInt varnames_inv;
+    // locals in these slots hold a `Cell`, they are accessed by `*_DEREF` opcodes
+    pod_vector<int> cellvars;           // indices in varnames, captured by nested functions
+    pod_vector<FreeVar> freevars;       // captured from the enclosing function
     std::vector<CodeBlock> blocks = { CodeBlock(NO_BLOCK, -1, 0, 0) };
     NameDictInt labels;
     std::vector<FuncDecl_> func_decls;
+    mutable std::vector<AttrCache> attr_caches;     // indexed by ip, empty if no attribute access
+    int num_unoptimized_codes = 0;                  // instruction count before `optimize()`
 
     CodeObject(std::shared_ptr<SourceData> src, const Str& name);
+    void optimize();
     void _gc_mark() const;
     void write(VM* vm, CodeObjectSerializer& ss) const;
     Str serialize(VM* vm) const;
+    void _alloc_attr_caches();
+
+    Bytes dump(VM* vm) const;
+    // returns nullptr if `data` is invalid or was dumped from a different source
+    static CodeObject_ load(VM* vm, const Bytes& data, std::shared_ptr<SourceData> src);
 };
 
 struct FuncDecl {
@@ -127,11 +210,13 @@ struct FuncDecl {
     pod_vector<KwArg> kwargs;   // indices in co->varnames
     int starred_arg = -1;       // index in co->varnames, -1 if no *arg
     int starred_kwarg = -1;     // index in co->varnames, -1 if no **kwarg
-    bool nested = false;        // whether this function is nested
+    // only positional parameters, which are the first locals, see `VM::vectorcall()`
+    bool is_simple = false;
 
     Str signature;              // signature of this function
     Str docstring;              // docstring of this function
     void _gc_mark() const;
+    void _init_is_simple();     // call this after the parameters are set
 };
 
 struct UserData{
@@ -186,7 +271,7 @@ struct NativeFunc {
 struct Function{
     FuncDecl_ decl;
     PyObject* _module;
-    NameDict_ _closure;
+    PyObject* _closure = nullptr;   // a tuple of cells, one for each of `decl->code->freevars`
 };
 
 template<>
@@ -196,14 +281,10 @@ struct Py_<Function> final: PyObject {
     Py_(Type type, Args&&... args): PyObject(type), _value(std::forward<Args>(args)...) {
         enable_instance_dict();
     }
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         _value.decl->_gc_mark();
         if(_value._module != nullptr) PK_OBJ_MARK(_value._module);
-        if(_value._closure != nullptr) gc_mark_namedict(*_value._closure);
-    }
-
-    void* _value_ptr() override {
-        return &_value;
+        if(_value._closure != nullptr) PK_OBJ_MARK(_value._closure);
     }
 };
 
@@ -214,14 +295,11 @@ struct Py_<NativeFunc> final: PyObject {
     Py_(Type type, Args&&... args): PyObject(type), _value(std::forward<Args>(args)...) {
         enable_instance_dict();
     }
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         if(_value.decl != nullptr){
             _value.decl->_gc_mark();
         }
     }
-    void* _value_ptr() override {
-        return &_value;
-    }
 };
 
 template<typename T>
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "cffi.h"
+
+namespace pkpy{
+
+void add_module_collections(VM* vm);
+void add_module_heapq(VM* vm);
+void add_module_bisect(VM* vm);
+
+} // namespace pkpy
@@ -7,8 +7,10 @@
 #include <regex>
 #include <stdexcept>
 #include <vector>
+#include <deque>
 #include <string>
 #include <chrono>
+#include <thread>
 #include <string_view>
 #include <iomanip>
 #include <memory>
@@ -21,6 +23,7 @@
 #include <type_traits>
 #include <random>
 #include <bitset>
+#include <atomic>
 
 #define PK_VERSION				"1.2.4"
 
@@ -19,7 +19,8 @@ struct PrattRule{
 class Compiler {
     inline static PrattRule rules[kTokenCount];
     std::unique_ptr<Lexer> lexer;
-    stack<CodeEmitContext> contexts;
+    // a deque keeps `CodeEmitContext::parent` valid when contexts are pushed
+    stack<CodeEmitContext, std::deque<CodeEmitContext>> contexts;
     VM* vm;
     bool unknown_global_scope;     // for eval/exec() call
     bool used;
@@ -31,7 +32,7 @@ class Compiler {
     const Token& curr() const{ return tokens.at(i); }
     const Token& next() const{ return tokens.at(i+1); }
     const Token& err() const{
-        if(i >= tokens.size()) return prev();
+        if(i >= (int)tokens.size()) return prev();
         return curr();
     }
     void advance(int delta=1) { i += delta; }
@@ -83,6 +84,7 @@ class Compiler {
         match_newlines_repl();
     }
 
+    void _declare_comp_vars();
     void exprLiteral();
     void exprLong();
     void exprBytes();
@@ -44,6 +44,11 @@
 #define PK_DEBUG_NO_AUTO_GC         0
 #define PK_DEBUG_GC_STATS           0
 
+// Count executed opcode pairs and dump them to stderr at exit, see `run_opcode_pairs.sh`
+#ifndef PK_DEBUG_OPCODE_PAIRS       // can be overrided by cmake
+#define PK_DEBUG_OPCODE_PAIRS       0
+#endif
+
 /*************** internal settings ***************/
 
 // This is the maximum size of the value stack in void* units
@@ -7,31 +7,32 @@
 
 namespace pkpy{
 
+// https://github.com/python/cpython/blob/3.8/Objects/dictobject.c
+// `_indices` is a sparse hash table of indices into `_items`,
+// `_items` is a dense array of entries in insertion order.
 struct Dict{
     struct Item{
-        PyObject* first;
+        PyObject* first;    // nullptr if the entry is deleted
         PyObject* second;
-    };
-
-    struct ItemNode{
-        int prev;
-        int next;
+        i64 hash;
     };
 
     static constexpr int __Capacity = 8;
     static constexpr float __LoadFactor = 0.67f;
-    static_assert(sizeof(Item) * __Capacity <= 128);
-    static_assert(sizeof(ItemNode) * __Capacity <= 64);
+    static_assert(sizeof(Item) * int(__Capacity * __LoadFactor + 0.5f) <= 128);
+
+    static constexpr int kEmptySlot = -1;
+    static constexpr int kDeletedSlot = -2;
 
     VM* vm;
-    int _capacity;
+    int _capacity;          // size of `_indices`, a power of 2
     int _mask;
-    int _size;
-    int _critical_size;
-    int _head_idx;          // for order preserving
-    int _tail_idx;          // for order preserving
+    int _size;              // number of live entries
+    int _critical_size;     // max entries in `_items` before a rehash
+    int _items_len;         // number of used entries in `_items`, including deleted ones
+    int _index_bytes;       // 1, 2 or 4, the width of an index in `_indices`
+    void* _indices;
     Item* _items;
-    ItemNode* _nodes;       // for order preserving
 
     Dict(VM* vm);
     Dict(Dict&& other);
@@ -41,11 +42,29 @@ struct Dict{
 
     int size() const { return _size; }
 
-    void _probe_0(PyObject* key, bool& ok, int& i) const;
-    void _probe_1(PyObject* key, bool& ok, int& i) const;
+    int _index_at(int i) const {
+        switch(_index_bytes){
+            case 1: return ((const int8_t*)_indices)[i];
+            case 2: return ((const int16_t*)_indices)[i];
+            default: return ((const int32_t*)_indices)[i];
+        }
+    }
+
+    void _set_index(int i, int ix){
+        switch(_index_bytes){
+            case 1: ((int8_t*)_indices)[i] = (int8_t)ix; break;
+            case 2: ((int16_t*)_indices)[i] = (int16_t)ix; break;
+            default: ((int32_t*)_indices)[i] = (int32_t)ix; break;
+        }
+    }
+
+    i64 _hash(PyObject* key) const;
+    void _probe_0(PyObject* key, i64 hash, bool& ok, int& i) const;
+    void _probe_1(PyObject* key, i64 hash, bool& ok, int& i) const;
 
     void set(PyObject* key, PyObject* val);
-    void _rehash();
+    void _alloc(int capacity);
+    void _rehash(int n);
 
     PyObject* try_get(PyObject* key) const;
 
@@ -55,10 +74,11 @@ struct Dict{
 
     template<typename __Func>
     void apply(__Func f) const {
-        int i = _head_idx;
-        while(i != -1){
-            f(_items[i].first, _items[i].second);
-            i = _nodes[i].next;
+        // `f` may resize the dict, so the entries are re-read each time
+        for(int i=0; i<_items_len; i++){
+            PyObject* key = _items[i].first;
+            if(key == nullptr) continue;
+            f(key, _items[i].second);
         }
     }
 
@@ -70,4 +90,35 @@ struct Dict{
     void _gc_mark() const;
 };
 
-} // namespace pkpy
\ No newline at end of file
+// `set` and `frozenset` share the probing of `Dict`, each value is its key
+struct Set{
+    Dict _dict;
+
+    Set(VM* vm): _dict(vm) {}
+    Set(Set&& other): _dict(std::move(other._dict)) {}
+    Set(const Set& other): _dict(other._dict) {}
+    Set& operator=(const Set&) = delete;
+    Set& operator=(Set&&) = delete;
+
+    int size() const { return _dict.size(); }
+    void add(PyObject* key){ _dict.set(key, key); }
+    bool contains(PyObject* key) const { return _dict.contains(key); }
+    bool discard(PyObject* key){ return _dict.erase(key); }
+    // removes the last added key, `Dict::erase` keeps the last entry live
+    PyObject* pop(){
+        PyObject* key = _dict._items[_dict._items_len-1].first;
+        _dict.erase(key);
+        return key;
+    }
+    void clear(){ _dict.clear(); }
+
+    template<typename __Func>
+    void apply(__Func f) const {
+        _dict.apply([&](PyObject* k, PyObject* v){ f(k); });
+    }
+
+    Tuple keys() const { return _dict.keys(); }
+    void _gc_mark() const { _dict._gc_mark(); }
+};
+
+} // namespace pkpy
@@ -27,6 +27,12 @@ struct Expr{
 
     std::string str() const { PK_ASSERT(false); }
 
+    // constant folding, returns nullptr if it is not a compile-time constant
+    virtual PyObject* fold(CodeEmitContext* ctx);
+    // folds a scalar constant without allocating, returns false if it is not one
+    virtual bool fold_value(CodeEmitContext* ctx, TokenValue& out) { PK_UNUSED(ctx); PK_UNUSED(out); return false; }
+    virtual bool is_foldable(CodeEmitContext* ctx) { TokenValue out; return fold_value(ctx, out); }
+
     // for OP_DELETE_XXX
     [[nodiscard]] virtual bool emit_del(CodeEmitContext* ctx) {
         PK_UNUSED(ctx);
@@ -43,12 +49,14 @@ struct Expr{
 struct CodeEmitContext{
     VM* vm;
     CodeObject_ co;
+    CodeEmitContext* parent;    // the enclosing context, nullptr for the global one
     // some bugs on MSVC (error C2280) when using std::vector<Expr_>
     // so we use stack_no_copy instead
     stack_no_copy<Expr_> s_expr;
     int level;
     std::set<Str> global_names;
-    CodeEmitContext(VM* vm, CodeObject_ co, int level): vm(vm), co(co), level(level) {}
+    std::set<StrName> nonlocal_names;
+    CodeEmitContext(VM* vm, CodeObject_ co, int level, CodeEmitContext* parent): vm(vm), co(co), parent(parent), level(level) {}
 
     int curr_block_i = 0;
     bool is_compiling_class = false;
@@ -60,9 +68,13 @@ struct CodeEmitContext{
     void emit_expr();   // clear the expression stack and generate bytecode
     std::string _log_s_expr();
     int emit(Opcode opcode, int arg, int line);
+    void emit_const(PyObject* obj, int line);
     void patch_jump(int index);
     bool add_label(StrName name);
     int add_varname(StrName name);
+    int add_varname_for_store(StrName name);
+    int add_freevar(StrName name);
+    bool is_freevar(int index) const;
     int add_const(PyObject* v);
     int add_func_decl(FuncDecl_ decl);
 };
@@ -117,6 +129,8 @@ struct Literal0Expr: Expr{
     bool is_json_object() const override { return true; }
 
     void emit(CodeEmitContext* ctx) override;
+    PyObject* fold(CodeEmitContext* ctx) override;
+    bool is_foldable(CodeEmitContext* ctx) override { PK_UNUSED(ctx); return true; }
 };
 
 struct LongExpr: Expr{
@@ -136,6 +150,7 @@ struct LiteralExpr: Expr{
     TokenValue value;
     LiteralExpr(TokenValue value): value(value) {}
     void emit(CodeEmitContext* ctx) override;
+    bool fold_value(CodeEmitContext* ctx, TokenValue& out) override;
     bool is_literal() const override { return true; }
     bool is_json_object() const override { return true; }
 };
@@ -144,6 +159,7 @@ struct NegatedExpr: Expr{
     Expr_ child;
     NegatedExpr(Expr_&& child): child(std::move(child)) {}
     void emit(CodeEmitContext* ctx) override;
+    bool fold_value(CodeEmitContext* ctx, TokenValue& out) override;
     bool is_json_object() const override { return child->is_literal(); }
 };
 
@@ -208,6 +224,9 @@ struct TupleExpr: SequenceExpr{
         return OP_BUILD_TUPLE;
     }
 
+    void emit(CodeEmitContext* ctx) override;
+    PyObject* fold(CodeEmitContext* ctx) override;
+    bool is_foldable(CodeEmitContext* ctx) override;
     bool emit_store(CodeEmitContext* ctx) override;
     bool emit_del(CodeEmitContext* ctx) override;
 };
@@ -301,6 +320,18 @@ struct GroupedExpr: Expr{
     bool emit_store(CodeEmitContext* ctx) override {
         return a->emit_store(ctx);
     }
+
+    PyObject* fold(CodeEmitContext* ctx) override {
+        return a->fold(ctx);
+    }
+
+    bool fold_value(CodeEmitContext* ctx, TokenValue& out) override {
+        return a->fold_value(ctx, out);
+    }
+
+    bool is_foldable(CodeEmitContext* ctx) override {
+        return a->is_foldable(ctx);
+    }
 };
 
 struct BinaryExpr: Expr{
@@ -310,6 +341,7 @@ struct BinaryExpr: Expr{
     bool is_compare() const override;
     void _emit_compare(CodeEmitContext* ctx, std::vector<int>& jmps);
     void emit(CodeEmitContext* ctx) override;
+    bool fold_value(CodeEmitContext* ctx, TokenValue& out) override;
 };
 
 
@@ -23,7 +23,6 @@ struct FastLocals{
     FastLocals(const FastLocals& other): varnames_inv(other.varnames_inv), a(other.a) {}
 
     PyObject** try_get_name(StrName name);
-    NameDict_ to_namedict();
 
     PyObject** begin() const { return a; }
     PyObject** end() const { return a + size(); }
@@ -81,26 +80,28 @@ struct Frame {
     int _ip = -1;
     int _next_ip = 0;
     ValueStack* _s;
-    // This is for unwinding only, use `actual_sp_base()` for value stack access
+    // This is for unwinding only, use `_stack_base` for value stack access
     PyObject** _sp_base;
 
     const CodeObject* co;
     PyObject* _module;
     PyObject* _callable;    // weak ref
     FastLocals _locals;
+    // the operand stack of this frame starts here, it is not always right after `_locals`,
+    // e.g. the locals of a generator or an `exec()` frame live somewhere else
+    PyObject** _stack_base;
 
     NameDict& f_globals() noexcept { return _module->attr(); }
-    
-    PyObject* f_closure_try_get(StrName name);
 
     Frame(ValueStack* _s, PyObject** p0, const CodeObject* co, PyObject* _module, PyObject* _callable)
-            : _s(_s), _sp_base(p0), co(co), _module(_module), _callable(_callable), _locals(co, p0) { }
+            : _s(_s), _sp_base(p0), co(co), _module(_module), _callable(_callable), _locals(co, p0), _stack_base(_locals.end()) { }
 
+    // `_locals` are pushed already, or belong to another frame
     Frame(ValueStack* _s, PyObject** p0, const CodeObject* co, PyObject* _module, PyObject* _callable, FastLocals _locals)
-            : _s(_s), _sp_base(p0), co(co), _module(_module), _callable(_callable), _locals(_locals) { }
+            : _s(_s), _sp_base(p0), co(co), _module(_module), _callable(_callable), _locals(_locals), _stack_base(_s->_sp) { }
 
     Frame(ValueStack* _s, PyObject** p0, const CodeObject_& co, PyObject* _module)
-            : _s(_s), _sp_base(p0), co(co.get()), _module(_module), _callable(nullptr), _locals(co.get(), p0) {}
+            : _s(_s), _sp_base(p0), co(co.get()), _module(_module), _callable(nullptr), _locals(co.get(), p0), _stack_base(_locals.end()) {}
 
     Bytecode next_bytecode() {
         _ip = _next_ip++;
@@ -110,9 +111,8 @@ struct Frame {
         return co->codes[_ip];
     }
 
-    PyObject** actual_sp_base() const { return _locals.a; }
-    int stack_size() const { return _s->_sp - actual_sp_base(); }
-    ArgsView stack_view() const { return ArgsView(actual_sp_base(), _s->_sp); }
+    int stack_size() const { return _s->_sp - _stack_base; }
+    ArgsView stack_view() const { return ArgsView(_stack_base, _s->_sp); }
 
     void jump_abs(int i){ _next_ip = i; }
     bool jump_to_exception_handler();
@@ -122,6 +122,8 @@ struct Frame {
     void _gc_mark() const {
         PK_OBJ_MARK(_module);
         co->_gc_mark();
+        // a generator keeps its locals out of the value stack
+        if(co->is_generator) for(PyObject* obj: _locals) PK_OBJ_MARK(obj);
     }
 };
 
@@ -7,9 +7,36 @@
 #include "namedict.h"
 
 namespace pkpy {
+struct GCStats{
+    int collections = 0;
+    i64 collected = 0;
+    i64 pause_total_us = 0;
+    i64 pause_max_us = 0;
+};
+
+/* Two generations with sticky mark bits:
+ * a young object survives a minor collection and becomes old, and keeps `gc.marked` set,
+ * so the marking of a minor collection stops at old objects.
+ * Old objects that may reference young ones are recorded by `write_barrier()`,
+ * objects in `_no_gc` (types and modules) are always scanned.
+ *
+ * In the incremental mode (`step_budget_us > 0`) there are no minor collections.
+ * A cycle marks the whole heap in time-budgeted steps and then sweeps it the same way.
+ * Objects are white when unmarked, gray when marked but not scanned and black when scanned.
+ * `write_barrier()` records black objects that get new references so they are scanned again,
+ * and objects allocated while marking start gray.
+ * Roots and `_no_gc` have no write barriers, so they are rescanned in budgeted steps once the gray
+ * objects run out, and then once more in a final remark which is not budgeted.
+ * A single object is scanned at once, so a step over a very large container exceeds the budget.
+ */
+enum GCPhase{ GC_IDLE, GC_MARKING, GC_SWEEPING };
+
 struct ManagedHeap{
     std::vector<PyObject*> _no_gc;
-    std::vector<PyObject*> gen;
+    std::vector<PyObject*> gen;         // young generation
+    std::vector<PyObject*> old_gen;
+    std::vector<PyObject*> _remembered;
+    std::vector<PyObjectHooks> _type_hooks;     // indexed by type, set by the first `Py_<T>` of each type
     VM* vm;
     void (*_gc_on_delete)(VM*, PyObject*) = nullptr;
     void (*_gc_marker_ex)(VM*) = nullptr;
@@ -17,8 +44,30 @@ struct ManagedHeap{
     ManagedHeap(VM* vm): vm(vm) {}
     
     static const int kMinGCThreshold = 3072;
-    int gc_threshold = kMinGCThreshold;
+    static const int kMinOldThreshold = 32768;
+    int gc_threshold = kMinGCThreshold * 4;     // allocations before a minor collection
+    int old_threshold = kMinOldThreshold;       // old objects before a full collection
     int gc_counter = 0;
+    GCStats stats[2];   // young, old
+
+    int step_budget_us = 0;     // microseconds per automatic step, 0 means generational
+    int step_interval = 256;    // allocations between two automatic steps
+    GCPhase phase = GC_IDLE;
+    std::vector<PyObject*> _gray;   // gray objects of an unfinished marking
+    int _rescan_i = -1;         // next object of `_no_gc` to rescan before the remark, -1 if not started
+    int _sweep_i = 0;           // next object of `old_gen` to sweep
+    int _sweep_j = 0;           // survivors are compacted to `old_gen[0, _sweep_j)`
+    i64 _cycle_freed = 0;
+
+    bool incremental() const { return step_budget_us > 0; }
+
+    // call this after storing a reference into `obj`
+    void write_barrier(PyObject* obj){
+        if(obj->gc.marked && !obj->gc.remembered){
+            obj->gc.remembered = true;
+            _remembered.push_back(obj);
+        }
+    }
 
     /********************/
     int _gc_lock_counter = 0;
@@ -41,9 +90,14 @@ struct ManagedHeap{
     PyObject* gcnew(Type type, Args&&... args){
         using __T = Py_<std::decay_t<T>>;
         // https://github.com/blueloveTH/pocketpy/issues/94#issuecomment-1594784476
+        _register_hooks<std::decay_t<T>>(type);
         PyObject* obj = new(pool64_alloc<__T>()) Py_<std::decay_t<T>>(type, std::forward<Args>(args)...);
         gen.push_back(obj);
         gc_counter++;
+        if(phase == GC_MARKING){
+            obj->gc.marked = true;
+            _gray.push_back(obj);
+        }
         return obj;
     }
 
@@ -51,20 +105,50 @@ struct ManagedHeap{
     PyObject* _new(Type type, Args&&... args){
         using __T = Py_<std::decay_t<T>>;
         // https://github.com/blueloveTH/pocketpy/issues/94#issuecomment-1594784476
+        _register_hooks<std::decay_t<T>>(type);
         PyObject* obj = new(pool64_alloc<__T>()) Py_<std::decay_t<T>>(type, std::forward<Args>(args)...);
         obj->gc.enabled = false;
+        obj->gc.remembered = true;      // always scanned
         _no_gc.push_back(obj);
         return obj;
     }
 
+    template<typename T>
+    void _register_hooks(Type type){
+        const PyObjectHooks& hooks = kPyObjectHooks<T>;
+        if(type.index < (int)_type_hooks.size() && _type_hooks[type.index].destroy == hooks.destroy) return;
+        _set_hooks(type, hooks);
+    }
+
+    void _scan(PyObject* obj){
+        _type_hooks[obj->type.index].gc_mark(obj);
+        if(obj->is_attr_valid()) gc_mark_namedict(obj->attr());
+    }
+
 #if PK_DEBUG_GC_STATS
     inline static std::map<Type, int> deleted;
 #endif
 
+    void _set_hooks(Type type, const PyObjectHooks& hooks);
+
+    void _delete(PyObject* obj);
     int sweep();
+    int sweep_young();
     void _auto_collect();
     int collect();
+    int collect_young();
     void mark();
+    void mark_young();
+    void _mark_roots();
+    void _propagate();
+
+    bool step(int budget_us);
+    void set_incremental(int budget_us);
+    void _start_cycle();
+    bool _mark_step(std::chrono::steady_clock::time_point deadline);
+    void _finish_marking();
+    bool _sweep_step(std::chrono::steady_clock::time_point deadline);
+    void _abort_cycle();
     ~ManagedHeap();
 };
 
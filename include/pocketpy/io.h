@@ -4,6 +4,8 @@
 
 namespace pkpy{
     Bytes _default_import_handler(const Str& name);
+    Bytes _default_bytecode_cache_loader(const Str& name);
+    void _default_bytecode_cache_writer(const Str& name, const Bytes& data);
     void add_module_os(VM* vm);
     void add_module_io(VM* vm);
 }
@@ -18,13 +20,32 @@ namespace pkpy{
 struct FileIO {
     PY_CLASS(FileIO, io, FileIO)
 
+    static constexpr int kBufferSize = 64 * 1024;
+
     Str file;
     Str mode;
     FILE* fp;
+    std::string _rbuf;      // bytes read ahead, `_rbuf[_rpos:]` are not consumed yet
+    int _rpos = 0;
+    std::string _wbuf;      // bytes written but not flushed yet
+
+    bool is_text() const { return mode.sv().find('b') == std::string_view::npos; }
+    bool is_readable() const { return mode.sv().find_first_of("r+") != std::string_view::npos; }
+    bool is_writable() const { return mode.sv().find_first_of("wax+") != std::string_view::npos; }
 
-    bool is_text() const { return mode != "rb" && mode != "wb" && mode != "ab"; }
     FileIO(VM* vm, std::string file, std::string mode);
+    ~FileIO(){ close(); }
+
+    std::string read(i64 size);
+    std::string readline();
+    void write(std::string_view s);
+    bool flush();
+    i64 tell();
+    i64 seek(i64 offset, int whence);
     void close();
+
+    bool _fill();
+    void _drop_read_ahead();
     static void _register(VM* vm, PyObject* mod, PyObject* type);
 };
 
@@ -42,22 +42,83 @@ struct StringIter{
     static void _register(VM* vm, PyObject* mod, PyObject* type);
 };
 
+// lazy iterators of builtins, `__next__` is native so `FOR_ITER` calls them directly
+struct MapIter{
+    PY_CLASS(MapIter, builtins, map)
+    PyObject* f;
+    PyObject* it;
+
+    MapIter(PyObject* f, PyObject* it) : f(f), it(it) {}
+
+    void _gc_mark() const{ PK_OBJ_MARK(f); PK_OBJ_MARK(it); }
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
+struct FilterIter{
+    PY_CLASS(FilterIter, builtins, filter)
+    PyObject* f;    // `None` tests the items themselves
+    PyObject* it;
+
+    FilterIter(PyObject* f, PyObject* it) : f(f), it(it) {}
+
+    void _gc_mark() const{ PK_OBJ_MARK(f); PK_OBJ_MARK(it); }
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
+struct ZipIter{
+    PY_CLASS(ZipIter, builtins, zip)
+    List its;
+
+    ZipIter(List&& its) : its(std::move(its)) {}
+
+    void _gc_mark() const{ for(PyObject* obj: its) PK_OBJ_MARK(obj); }
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
+struct EnumerateIter{
+    PY_CLASS(EnumerateIter, builtins, enumerate)
+    PyObject* it;
+    i64 index;
+
+    EnumerateIter(PyObject* it, i64 start) : it(it), index(start) {}
+
+    void _gc_mark() const{ PK_OBJ_MARK(it); }
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
+struct ReversedIter{
+    PY_CLASS(ReversedIter, builtins, reversed)
+    PyObject* ref;  // a list or a tuple
+    i64 index;      // the next item, -1 if exhausted
+
+    ReversedIter(PyObject* ref, i64 index) : ref(ref), index(index) {}
+
+    void _gc_mark() const{ PK_OBJ_MARK(ref); }
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
 struct Generator{
     PY_CLASS(Generator, builtins, "generator")
     Frame frame;
     int state;      // 0,1,2
-    List s_backup;
+    List s_locals;  // `frame._locals` points here, so they stay in place across yields
+    List s_backup;  // the operand stack of the suspended frame, e.g. iterators of for loops
 
-    Generator(Frame&& frame, ArgsView buffer): frame(std::move(frame)), state(0) {
-        for(PyObject* obj: buffer) s_backup.push_back(obj);
+    Generator(Frame&& frame, ArgsView buffer): frame(std::move(frame)), state(0), s_locals(buffer.size()) {
+        for(int i=0; i<buffer.size(); i++) s_locals[i] = buffer[i];
+        this->frame._locals.a = s_locals.data();
     }
 
     void _gc_mark() const{
-        frame._gc_mark();
+        frame._gc_mark();   // marks `s_locals`
         for(PyObject* obj: s_backup) PK_OBJ_MARK(obj);
     }
 
     PyObject* next(VM* vm);
+    // push the frame back to the callstack, see also `FOR_ITER`
+    void _resume(VM* vm);
+    // save the top frame after a yield and return the yielded value
+    PyObject* _suspend(VM* vm);
     static void _register(VM* vm, PyObject* mod, PyObject* type);
 };
 
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "cffi.h"
+
+namespace pkpy{
+
+// Appends the JSON text of objects into one growable buffer.
+// Builtin types are written directly, others go through `__json__`.
+struct JsonWriter{
+    static constexpr int kMaxDepth = 1000;
+
+    VM* vm;
+    std::string buf;
+    std::vector<PyObject*> _path;   // containers being written, to detect cycles
+
+    JsonWriter(VM* vm): vm(vm) {}
+
+    void write(PyObject* obj);
+    void write_str(const Str& s);
+    void write_float(f64 val);
+    void write_list(PyObject* obj);
+    void write_tuple(PyObject* obj);
+    void write_dict(PyObject* obj);
+
+    void _enter(PyObject* obj);
+    Str str() const { return Str(buf); }
+};
+
+PyObject* json_loads(VM* vm, std::string_view s);
+Str json_dumps(VM* vm, PyObject* obj);
+
+void add_module_json(VM* vm);
+
+} // namespace pkpy
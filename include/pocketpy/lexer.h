@@ -24,7 +24,7 @@ constexpr const char* kTokens[] = {
     "++", "--", "~",
     /** KW_BEGIN **/
     "class", "import", "as", "def", "lambda", "pass", "del", "from", "with", "yield",
-    "None", "in", "is", "and", "or", "not", "True", "False", "global", "try", "except", "finally",
+    "None", "in", "is", "and", "or", "not", "True", "False", "global", "nonlocal", "try", "except", "finally",
     "while", "for", "if", "elif", "else", "break", "continue", "return", "assert", "raise"
 };
 
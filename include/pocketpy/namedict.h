@@ -6,33 +6,33 @@
 
 namespace pkpy{
 
-inline const uint16_t kHashSeeds[] = {9629, 43049, 13267, 59509, 39251, 1249, 27689, 9719, 19913};
+inline const uint32_t kHashSeeds[] = {9629, 43049, 13267, 59509, 39251, 1249, 27689, 9719, 19913};
 
-inline uint16_t _hash(StrName key, uint16_t mask, uint16_t hash_seed){
+inline uint32_t _hash(StrName key, uint32_t mask, uint32_t hash_seed){
     return ( (key).index * (hash_seed) >> 8 ) & (mask);
 }
 
-uint16_t _find_perfect_hash_seed(uint16_t capacity, const std::vector<StrName>& keys);
+uint32_t _find_perfect_hash_seed(uint32_t capacity, const std::vector<StrName>& keys);
 
 template<typename T>
 struct NameDictImpl {
     using Item = std::pair<StrName, T>;
-    static constexpr uint16_t __Capacity = 8;
+    static constexpr uint32_t __Capacity = 8;
     // ensure the initial capacity is ok for memory pool
     static_assert(is_pod<T>::value);
     static_assert(sizeof(Item) * __Capacity <= 128);
 
     float _load_factor;
-    uint16_t _capacity;
-    uint16_t _size;
-    uint16_t _hash_seed;
-    uint16_t _mask;
+    uint32_t _capacity;
+    uint32_t _size;
+    uint32_t _hash_seed;
+    uint32_t _mask;
     Item* _items;
 
 #define HASH_PROBE_0(key, ok, i)            \
 ok = false;                                 \
 i = _hash(key, _mask, _hash_seed);          \
-for(int _j=0; _j<_capacity; _j++) {         \
+for(uint32_t _j=0; _j<_capacity; _j++) {    \
     if(!_items[i].first.empty()){           \
         if(_items[i].first == (key)) { ok = true; break; }  \
     }else{                                                  \
@@ -51,7 +51,7 @@ while(!_items[i].first.empty()) {           \
 
 #define NAMEDICT_ALLOC()                \
     _items = (Item*)pool128_alloc(_capacity * sizeof(Item));    \
-    memset(_items, 0, _capacity * sizeof(Item));                \
+    memset((void*)_items, 0, _capacity * sizeof(Item));         \
 
     NameDictImpl(float load_factor=0.67f):
         _load_factor(load_factor), _capacity(__Capacity), _size(0), 
@@ -62,14 +62,14 @@ while(!_items[i].first.empty()) {           \
     NameDictImpl(const NameDictImpl& other) {
         memcpy(this, &other, sizeof(NameDictImpl));
         NAMEDICT_ALLOC()
-        for(int i=0; i<_capacity; i++) _items[i] = other._items[i];
+        for(uint32_t i=0; i<_capacity; i++) _items[i] = other._items[i];
     }
 
     NameDictImpl& operator=(const NameDictImpl& other) {
         pool128_dealloc(_items);
         memcpy(this, &other, sizeof(NameDictImpl));
         NAMEDICT_ALLOC()
-        for(int i=0; i<_capacity; i++) _items[i] = other._items[i];
+        for(uint32_t i=0; i<_capacity; i++) _items[i] = other._items[i];
         return *this;
     }
     
@@ -77,17 +77,17 @@ while(!_items[i].first.empty()) {           \
 
     NameDictImpl(NameDictImpl&&) = delete;
     NameDictImpl& operator=(NameDictImpl&&) = delete;
-    uint16_t size() const { return _size; }
+    uint32_t size() const { return _size; }
 
     T operator[](StrName key) const {
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_0(key, ok, i);
         if(!ok) throw std::out_of_range(fmt("NameDict key not found: ", key));
         return _items[i].second;
     }
 
     void set(StrName key, T val){
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_1(key, ok, i);
         if(!ok) {
             _size++;
@@ -102,15 +102,15 @@ while(!_items[i].first.empty()) {           \
 
     void _rehash(bool resize){
         Item* old_items = _items;
-        uint16_t old_capacity = _capacity;
+        uint32_t old_capacity = _capacity;
         if(resize){
             _capacity *= 2;
             _mask = _capacity - 1;
         }
         NAMEDICT_ALLOC()
-        for(uint16_t i=0; i<old_capacity; i++){
+        for(uint32_t i=0; i<old_capacity; i++){
             if(old_items[i].first.empty()) continue;
-            bool ok; uint16_t j;
+            bool ok; uint32_t j;
             HASH_PROBE_1(old_items[i].first, ok, j);
             if(ok) FATAL_ERROR();
             _items[j] = old_items[i];
@@ -124,7 +124,7 @@ while(!_items[i].first.empty()) {           \
     }
 
     T try_get(StrName key) const{
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_0(key, ok, i);
         if(!ok){
             if constexpr(std::is_pointer_v<T>) return nullptr;
@@ -135,14 +135,14 @@ while(!_items[i].first.empty()) {           \
     }
 
     T* try_get_2(StrName key) {
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_0(key, ok, i);
         if(!ok) return nullptr;
         return &_items[i].second;
     }
 
     bool try_set(StrName key, T val){
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_1(key, ok, i);
         if(!ok) return false;
         _items[i].second = val;
@@ -150,20 +150,20 @@ while(!_items[i].first.empty()) {           \
     }
 
     bool contains(StrName key) const {
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_0(key, ok, i);
         return ok;
     }
 
     void update(const NameDictImpl& other){
-        for(uint16_t i=0; i<other._capacity; i++){
+        for(uint32_t i=0; i<other._capacity; i++){
             auto& item = other._items[i];
             if(!item.first.empty()) set(item.first, item.second);
         }
     }
 
     void erase(StrName key){
-        bool ok; uint16_t i;
+        bool ok; uint32_t i;
         HASH_PROBE_0(key, ok, i);
         if(!ok) throw std::out_of_range(fmt("NameDict key not found: ", key));
         _items[i].first = StrName();
@@ -173,7 +173,7 @@ while(!_items[i].first.empty()) {           \
 
     std::vector<Item> items() const {
         std::vector<Item> v;
-        for(uint16_t i=0; i<_capacity; i++){
+        for(uint32_t i=0; i<_capacity; i++){
             if(_items[i].first.empty()) continue;
             v.push_back(_items[i]);
         }
@@ -182,7 +182,7 @@ while(!_items[i].first.empty()) {           \
 
     template<typename __Func>
     void apply(__Func func) const {
-        for(uint16_t i=0; i<_capacity; i++){
+        for(uint32_t i=0; i<_capacity; i++){
             if(_items[i].first.empty()) continue;
             func(_items[i].first, _items[i].second);
         }
@@ -190,7 +190,7 @@ while(!_items[i].first.empty()) {           \
 
     std::vector<StrName> keys() const {
         std::vector<StrName> v;
-        for(uint16_t i=0; i<_capacity; i++){
+        for(uint32_t i=0; i<_capacity; i++){
             if(_items[i].first.empty()) continue;
             v.push_back(_items[i].first);
         }
@@ -198,7 +198,7 @@ while(!_items[i].first.empty()) {           \
     }
 
     void clear(){
-        for(uint16_t i=0; i<_capacity; i++){
+        for(uint32_t i=0; i<_capacity; i++){
             _items[i].first = StrName();
             _items[i].second = nullptr;
         }
@@ -47,6 +47,12 @@ struct StarWrapper{
     StarWrapper(int level, PyObject* obj) : level(level), obj(obj) {}
 };
 
+// a local variable shared by a function and its nested functions
+struct Cell{
+    PyObject* value;    // PY_NULL if unbound
+    Cell(PyObject* value) : value(value) {}
+};
+
 struct Bytes{
     unsigned char* _data;
     int _size;
@@ -131,8 +137,9 @@ struct Slice {
 
 struct GCHeader {
     bool enabled;   // whether this object is managed by GC
-    bool marked;    // whether this object is marked
-    GCHeader() : enabled(true), marked(false) {}
+    bool marked;    // whether this object is marked, stays true for old objects
+    bool remembered;    // whether this object is in the remembered set
+    GCHeader() : enabled(true), marked(false), remembered(false) {}
 };
 
 struct PyObject{
@@ -144,12 +151,10 @@ struct PyObject{
     NameDict& attr() noexcept { return *_attr; }
     PyObject* attr(StrName name) const noexcept { return (*_attr)[name]; }
 
-    virtual void _obj_gc_mark() = 0;
-    virtual void* _value_ptr() = 0;
-
     PyObject(Type type) : type(type), _attr(nullptr) {}
 
-    virtual ~PyObject();
+    // not virtual, `ManagedHeap` destroys objects by `PyObjectHooks`
+    ~PyObject();
 
     void enable_instance_dict(float lf=kInstAttrLoadFactor) {
         _attr = new(pool64_alloc<NameDict>()) NameDict(lf);
@@ -160,8 +165,6 @@ struct PySignalObject: PyObject {
     PySignalObject() : PyObject(0) {
         gc.enabled = false;
     }
-    void _obj_gc_mark() override {}
-    void* _value_ptr() override { return nullptr; }
 };
 
 inline PyObject* const PY_NULL = new PySignalObject();
@@ -201,18 +204,29 @@ template <typename T> struct has_gc_marker<T, std::void_t<decltype(&T::_gc_mark)
 template <typename T>
 struct Py_ final: PyObject {
     T _value;
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         if constexpr (has_gc_marker<T>::value) {
             _value._gc_mark();
         }
     }
 
-    void* _value_ptr() override { return &_value; }
     
     template <typename... Args>
     Py_(Type type, Args&&... args) : PyObject(type), _value(std::forward<Args>(args)...) { }
 };
 
+// replaces the vtable, `ManagedHeap` keeps one per type
+struct PyObjectHooks{
+    void (*gc_mark)(PyObject*);
+    void (*destroy)(PyObject*);
+};
+
+template<typename T>
+inline constexpr PyObjectHooks kPyObjectHooks = {
+    [](PyObject* obj){ static_cast<Py_<T>*>(obj)->_obj_gc_mark(); },
+    [](PyObject* obj){ static_cast<Py_<T>*>(obj)->~Py_<T>(); },
+};
+
 struct MappingProxy{
     PyObject* obj;
     MappingProxy(PyObject* obj) : obj(obj) {}
@@ -221,16 +235,18 @@ struct MappingProxy{
 
 #define PK_OBJ_GET(T, obj) (((Py_<T>*)(obj))->_value)
 
+// marked objects stay gray until `ManagedHeap::_scan()` is called on them
+inline PK_THREAD_LOCAL std::vector<PyObject*> _gc_gray_objects;
+
 #define PK_OBJ_MARK(obj) \
     if(!is_tagged(obj) && !(obj)->gc.marked) {                      \
         (obj)->gc.marked = true;                                    \
-        (obj)->_obj_gc_mark();                                      \
-        if((obj)->is_attr_valid()) gc_mark_namedict((obj)->attr()); \
+        _gc_gray_objects.push_back(obj);                            \
     }
 
 inline void gc_mark_namedict(NameDict& t){
     if(t.size() == 0) return;
-    for(uint16_t i=0; i<t._capacity; i++){
+    for(uint32_t i=0; i<t._capacity; i++){
         if(t._items[i].first.empty()) continue;
         PK_OBJ_MARK(t._items[i].second);
     }
@@ -290,8 +306,7 @@ template<>
 struct Py_<i64> final: PyObject {
     i64 _value;
     Py_(Type type, i64 val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {}
-    void* _value_ptr() override { return &_value; }
+    void _obj_gc_mark() {}
 };
 
 inline bool try_cast_int(PyObject* obj, i64* val) noexcept {
@@ -312,10 +327,9 @@ struct Py_<List> final: PyObject {
     Py_(Type type, List&& val): PyObject(type), _value(std::move(val)) {}
     Py_(Type type, const List& val): PyObject(type), _value(val) {}
 
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         for(PyObject* obj: _value) PK_OBJ_MARK(obj);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
@@ -324,64 +338,67 @@ struct Py_<Tuple> final: PyObject {
     Py_(Type type, Tuple&& val): PyObject(type), _value(std::move(val)) {}
     Py_(Type type, const Tuple& val): PyObject(type), _value(val) {}
 
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         for(PyObject* obj: _value) PK_OBJ_MARK(obj);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
 struct Py_<MappingProxy> final: PyObject {
     MappingProxy _value;
     Py_(Type type, MappingProxy val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.obj);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
 struct Py_<BoundMethod> final: PyObject {
     BoundMethod _value;
     Py_(Type type, BoundMethod val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.self);
         PK_OBJ_MARK(_value.func);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
 struct Py_<StarWrapper> final: PyObject {
     StarWrapper _value;
     Py_(Type type, StarWrapper val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.obj);
     }
-    void* _value_ptr() override { return &_value; }
+};
+
+template<>
+struct Py_<Cell> final: PyObject {
+    Cell _value;
+    Py_(Type type, Cell val): PyObject(type), _value(val) {}
+    void _obj_gc_mark() {
+        PK_OBJ_MARK(_value.value);
+    }
 };
 
 template<>
 struct Py_<Property> final: PyObject {
     Property _value;
     Py_(Type type, Property val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.getter);
         PK_OBJ_MARK(_value.setter);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
 struct Py_<Slice> final: PyObject {
     Slice _value;
     Py_(Type type, Slice val): PyObject(type), _value(val) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.start);
         PK_OBJ_MARK(_value.stop);
         PK_OBJ_MARK(_value.step);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
@@ -389,10 +406,9 @@ struct Py_<Super> final: PyObject {
     Super _value;
     template<typename... Args>
     Py_(Type type, Args&&... args): PyObject(type), _value(std::forward<Args>(args)...) {}
-    void _obj_gc_mark() override {
+    void _obj_gc_mark() {
         PK_OBJ_MARK(_value.first);
     }
-    void* _value_ptr() override { return &_value; }
 };
 
 template<>
@@ -400,8 +416,7 @@ struct Py_<DummyInstance> final: PyObject {
     Py_(Type type): PyObject(type) {
         enable_instance_dict();
     }
-    void _obj_gc_mark() override {}
-    void* _value_ptr() override { return nullptr; }
+    void _obj_gc_mark() {}
 };
 
 template<>
@@ -410,8 +425,7 @@ struct Py_<Type> final: PyObject {
     Py_(Type type, Type val): PyObject(type), _value(val) {
         enable_instance_dict(kTypeAttrLoadFactor);
     }
-    void _obj_gc_mark() override {}
-    void* _value_ptr() override { return &_value; }
+    void _obj_gc_mark() {}
 };
 
 template<>
@@ -419,8 +433,7 @@ struct Py_<DummyModule> final: PyObject {
     Py_(Type type): PyObject(type) {
         enable_instance_dict(kTypeAttrLoadFactor);
     }
-    void _obj_gc_mark() override {}
-    void* _value_ptr() override { return nullptr; }
+    void _obj_gc_mark() {}
 };
 
 }   // namespace pkpy
\ No newline at end of file
@@ -17,22 +17,26 @@ OPCODE(LOAD_INTEGER)
 OPCODE(LOAD_ELLIPSIS)
 OPCODE(LOAD_FUNCTION)
 OPCODE(LOAD_NULL)
+OPCODE(LOAD_KWARG_NAME)
 /**************************/
 OPCODE(LOAD_FAST)
+OPCODE(LOAD_FAST_LOAD_FAST)
 OPCODE(LOAD_NAME)
-OPCODE(LOAD_NONLOCAL)
+OPCODE(LOAD_DEREF)
 OPCODE(LOAD_GLOBAL)
 OPCODE(LOAD_ATTR)
 OPCODE(LOAD_METHOD)
 OPCODE(LOAD_SUBSCR)
 
 OPCODE(STORE_FAST)
+OPCODE(STORE_DEREF)
 OPCODE(STORE_NAME)
 OPCODE(STORE_GLOBAL)
 OPCODE(STORE_ATTR)
 OPCODE(STORE_SUBSCR)
 
 OPCODE(DELETE_FAST)
+OPCODE(DELETE_DEREF)
 OPCODE(DELETE_NAME)
 OPCODE(DELETE_GLOBAL)
 OPCODE(DELETE_ATTR)
@@ -81,6 +85,7 @@ OPCODE(CONTAINS_OP)
 /**************************/
 OPCODE(JUMP_ABSOLUTE)
 OPCODE(POP_JUMP_IF_FALSE)
+OPCODE(POP_JUMP_IF_TRUE)
 OPCODE(JUMP_IF_TRUE_OR_POP)
 OPCODE(JUMP_IF_FALSE_OR_POP)
 OPCODE(SHORTCUT_IF_FALSE_OR_POP)
@@ -132,4 +137,33 @@ OPCODE(INC_FAST)
 OPCODE(DEC_FAST)
 OPCODE(INC_GLOBAL)
 OPCODE(DEC_GLOBAL)
+/**************************/
+// specialized by quickening, see `Bytecode::generic()`
+OPCODE(BINARY_ADD_FLOAT)
+OPCODE(BINARY_SUB_FLOAT)
+OPCODE(BINARY_MUL_FLOAT)
+OPCODE(BINARY_TRUEDIV_FLOAT)
+OPCODE(BINARY_ADD_STR)
+OPCODE(COMPARE_LT_INT)
+OPCODE(COMPARE_LE_INT)
+OPCODE(COMPARE_GT_INT)
+OPCODE(COMPARE_GE_INT)
+OPCODE(COMPARE_LT_FLOAT)
+OPCODE(COMPARE_LE_FLOAT)
+OPCODE(COMPARE_GT_FLOAT)
+OPCODE(COMPARE_GE_FLOAT)
+OPCODE(LOAD_SUBSCR_LIST_INT)
+OPCODE(STORE_SUBSCR_LIST_INT)
+OPCODE(FOR_ITER_RANGE)
+OPCODE(FOR_ITER_LIST)
+/**************************/
+// superinstructions, fused by `CodeObject::optimize()`
+OPCODE(LOAD_FAST_LOAD_INTEGER)
+OPCODE(LOAD_FAST_LOAD_ATTR)
+OPCODE(COMPARE_LT_JUMP_IF_FALSE)
+OPCODE(COMPARE_LE_JUMP_IF_FALSE)
+OPCODE(COMPARE_GT_JUMP_IF_FALSE)
+OPCODE(COMPARE_GE_JUMP_IF_FALSE)
+OPCODE(COMPARE_EQ_JUMP_IF_FALSE)
+OPCODE(COMPARE_NE_JUMP_IF_FALSE)
 #endif
\ No newline at end of file
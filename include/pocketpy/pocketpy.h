@@ -12,7 +12,10 @@
 #include "vm.h"
 #include "re.h"
 #include "random.h"
+#include "collections.h"
+#include "json.h"
 #include "bindings.h"
+#include "timsort.h"
 
 namespace pkpy {
 
@@ -21,7 +24,6 @@ void init_builtins(VM* _vm);
 void add_module_timeit(VM* vm);
 void add_module_time(VM* vm);
 void add_module_sys(VM* vm);
-void add_module_json(VM* vm);
 
 void add_module_math(VM* vm);
 void add_module_dis(VM* vm);
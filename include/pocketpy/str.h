@@ -8,6 +8,7 @@
 namespace pkpy {
 
 int utf8len(unsigned char c, bool suppress=false);
+uint64_t wyhash(const void* key, size_t len);
 
 struct Str{
     int size;
@@ -16,6 +17,7 @@ struct Str{
     char _inlined[16];
 
     mutable const char* _cached_c_str = nullptr;
+    mutable size_t _cached_hash = 0;    // 0 if not computed yet
 
     bool is_inlined() const { return data == _inlined; }
 
@@ -36,7 +38,11 @@ struct Str{
     char operator[](int idx) const { return data[idx]; }
     int length() const { return size; }
     bool empty() const { return size == 0; }
-    size_t hash() const{ return std::hash<std::string_view>()(sv()); }
+    size_t hash() const{
+        if(_cached_hash == 0) _cached_hash = _compute_hash();
+        return _cached_hash;
+    }
+    size_t _compute_hash() const;
 
     Str& operator=(const Str& other);
     Str operator+(const Str& other) const;
@@ -93,9 +99,9 @@ std::string fmt(Args&&... args) {
 }
 
 struct StrName {
-    uint16_t index;
+    uint32_t index;
     StrName();
-    explicit StrName(uint16_t index);
+    explicit StrName(uint32_t index);
     StrName(const char* s);
     StrName(const Str& s);
     std::string_view sv() const;
@@ -120,10 +126,8 @@ struct StrName {
         return this->index > other.index;
     }
 
-    static bool is_valid(int index);
+    static bool is_valid(int64_t index);
     static StrName get(std::string_view s);
-    static std::map<std::string, uint16_t, std::less<>>& _interned();
-    static std::vector<std::string>& _r_interned();
 };
 
 struct FastStrStream{
@@ -192,8 +196,6 @@ const StrName __package__ = StrName::get("__package__");
 const StrName __path__ = StrName::get("__path__");
 const StrName __class__ = StrName::get("__class__");
 
-const StrName pk_id_add = StrName::get("add");
-const StrName pk_id_set = StrName::get("set");
 const StrName pk_id_eval = StrName::get("eval");
 
 #define DEF_SNAME(name) const static StrName name(#name)
@@ -0,0 +1,311 @@
+#pragma once
+
+#include "common.h"
+
+namespace pkpy{
+
+// A stable, adaptive merge sort.
+// https://github.com/python/cpython/blob/3.11/Objects/listsort.txt
+// `Less` may throw, which leaves the array in an unspecified state,
+// so callers should sort a scratch copy and write it back on success.
+template<typename T, typename Less>
+struct TimSort{
+    static constexpr int kMinMerge = 64;
+    static constexpr int kMinGallop = 7;
+
+    struct Run{
+        int base;
+        int len;
+    };
+
+    T* a;
+    int n;
+    Less& less;
+    int min_gallop = kMinGallop;
+    std::vector<Run> runs;
+    std::vector<T> tmp;
+
+    TimSort(T* a, int n, Less& less): a(a), n(n), less(less) {}
+
+    static int min_run(int n){
+        int r = 0;
+        while(n >= kMinMerge){ r |= n & 1; n >>= 1; }
+        return n + r;
+    }
+
+    // returns k in [0, len] such that p[k-1] < key <= p[k]
+    int gallop_left(const T& key, T* p, int len, int hint){
+        int last_ofs = 0, ofs = 1;
+        if(less(p[hint], key)){
+            int max_ofs = len - hint;
+            while(ofs < max_ofs && less(p[hint+ofs], key)){
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if(ofs <= 0) ofs = max_ofs;
+            }
+            if(ofs > max_ofs) ofs = max_ofs;
+            last_ofs += hint;
+            ofs += hint;
+        }else{
+            int max_ofs = hint + 1;
+            while(ofs < max_ofs && !less(p[hint-ofs], key)){
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if(ofs <= 0) ofs = max_ofs;
+            }
+            if(ofs > max_ofs) ofs = max_ofs;
+            int t = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - t;
+        }
+        // p[last_ofs] < key <= p[ofs]
+        last_ofs++;
+        while(last_ofs < ofs){
+            int m = last_ofs + ((ofs - last_ofs) >> 1);
+            if(less(p[m], key)) last_ofs = m + 1;
+            else ofs = m;
+        }
+        return ofs;
+    }
+
+    // returns k in [0, len] such that p[k-1] <= key < p[k]
+    int gallop_right(const T& key, T* p, int len, int hint){
+        int last_ofs = 0, ofs = 1;
+        if(less(key, p[hint])){
+            int max_ofs = hint + 1;
+            while(ofs < max_ofs && less(key, p[hint-ofs])){
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if(ofs <= 0) ofs = max_ofs;
+            }
+            if(ofs > max_ofs) ofs = max_ofs;
+            int t = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - t;
+        }else{
+            int max_ofs = len - hint;
+            while(ofs < max_ofs && !less(key, p[hint+ofs])){
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if(ofs <= 0) ofs = max_ofs;
+            }
+            if(ofs > max_ofs) ofs = max_ofs;
+            last_ofs += hint;
+            ofs += hint;
+        }
+        // p[last_ofs] <= key < p[ofs]
+        last_ofs++;
+        while(last_ofs < ofs){
+            int m = last_ofs + ((ofs - last_ofs) >> 1);
+            if(less(key, p[m])) ofs = m;
+            else last_ofs = m + 1;
+        }
+        return ofs;
+    }
+
+    // sort a[lo, hi) where a[lo, start) is already sorted
+    void binary_insertion_sort(int lo, int hi, int start){
+        if(start == lo) start++;
+        for(; start < hi; start++){
+            T pivot = a[start];
+            int left = lo, right = start;
+            while(left < right){
+                int mid = (left + right) >> 1;
+                if(less(pivot, a[mid])) right = mid;
+                else left = mid + 1;
+            }
+            std::move_backward(a + left, a + start, a + start + 1);
+            a[left] = pivot;
+        }
+    }
+
+    // find the natural run starting at `lo` and make it ascending
+    int count_run(int lo, int hi){
+        int run_hi = lo + 1;
+        if(run_hi == hi) return 1;
+        if(less(a[run_hi++], a[lo])){
+            // strictly descending, so reversing keeps it stable
+            while(run_hi < hi && less(a[run_hi], a[run_hi-1])) run_hi++;
+            std::reverse(a + lo, a + run_hi);
+        }else{
+            while(run_hi < hi && !less(a[run_hi], a[run_hi-1])) run_hi++;
+        }
+        return run_hi - lo;
+    }
+
+    // precondition: a[base2] < a[base1] and a[base1+len1-1] > a[base2+len2-1]
+    void merge_lo(int base1, int len1, int base2, int len2){
+        tmp.assign(a + base1, a + base1 + len1);
+        T* cursor1 = tmp.data();
+        T* cursor2 = a + base2;
+        T* dest = a + base1;
+        int mg = min_gallop;
+        int count1, count2;
+        *dest++ = *cursor2++;
+        if(--len2 == 0 || len1 == 1) goto __DONE;
+        while(true){
+            count1 = count2 = 0;
+            do{
+                if(less(*cursor2, *cursor1)){
+                    *dest++ = *cursor2++;
+                    count2++; count1 = 0;
+                    if(--len2 == 0) goto __DONE;
+                }else{
+                    *dest++ = *cursor1++;
+                    count1++; count2 = 0;
+                    if(--len1 == 1) goto __DONE;
+                }
+            }while((count1 | count2) < mg);
+            do{
+                count1 = gallop_right(*cursor2, cursor1, len1, 0);
+                if(count1 != 0){
+                    dest = std::copy(cursor1, cursor1 + count1, dest);
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if(len1 <= 1) goto __DONE;
+                }
+                *dest++ = *cursor2++;
+                if(--len2 == 0) goto __DONE;
+                count2 = gallop_left(*cursor1, cursor2, len2, 0);
+                if(count2 != 0){
+                    dest = std::copy(cursor2, cursor2 + count2, dest);
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if(len2 == 0) goto __DONE;
+                }
+                *dest++ = *cursor1++;
+                if(--len1 == 1) goto __DONE;
+                mg--;
+            }while(count1 >= kMinGallop || count2 >= kMinGallop);
+            if(mg < 0) mg = 0;
+            mg += 2;
+        }
+__DONE:
+        min_gallop = mg < 1 ? 1 : mg;
+        dest = std::copy(cursor2, cursor2 + len2, dest);
+        std::copy(cursor1, cursor1 + len1, dest);
+    }
+
+    // precondition: a[base2] < a[base1] and a[base1+len1-1] > a[base2+len2-1]
+    void merge_hi(int base1, int len1, int base2, int len2){
+        tmp.assign(a + base2, a + base2 + len2);
+        T* run1 = a + base1;
+        T* cursor1 = a + base1 + len1 - 1;
+        T* cursor2 = tmp.data() + len2 - 1;
+        T* dest = a + base2 + len2 - 1;
+        int mg = min_gallop;
+        int count1, count2;
+        *dest-- = *cursor1--;
+        if(--len1 == 0 || len2 == 1) goto __DONE;
+        while(true){
+            count1 = count2 = 0;
+            do{
+                if(less(*cursor2, *cursor1)){
+                    *dest-- = *cursor1--;
+                    count1++; count2 = 0;
+                    if(--len1 == 0) goto __DONE;
+                }else{
+                    *dest-- = *cursor2--;
+                    count2++; count1 = 0;
+                    if(--len2 == 1) goto __DONE;
+                }
+            }while((count1 | count2) < mg);
+            do{
+                count1 = len1 - gallop_right(*cursor2, run1, len1, len1 - 1);
+                if(count1 != 0){
+                    dest -= count1;
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    std::copy_backward(cursor1 + 1, cursor1 + 1 + count1, dest + 1 + count1);
+                    if(len1 == 0) goto __DONE;
+                }
+                *dest-- = *cursor2--;
+                if(--len2 == 1) goto __DONE;
+                count2 = len2 - gallop_left(*cursor1, tmp.data(), len2, len2 - 1);
+                if(count2 != 0){
+                    dest -= count2;
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    std::copy(cursor2 + 1, cursor2 + 1 + count2, dest + 1);
+                    if(len2 <= 1) goto __DONE;
+                }
+                *dest-- = *cursor1--;
+                if(--len1 == 0) goto __DONE;
+                mg--;
+            }while(count1 >= kMinGallop || count2 >= kMinGallop);
+            if(mg < 0) mg = 0;
+            mg += 2;
+        }
+__DONE:
+        min_gallop = mg < 1 ? 1 : mg;
+        std::copy_backward(run1, run1 + len1, run1 + len1 + len2);
+        std::copy(tmp.data(), tmp.data() + len2, run1);
+    }
+
+    void merge_at(int i){
+        int base1 = runs[i].base, len1 = runs[i].len;
+        int base2 = runs[i+1].base, len2 = runs[i+1].len;
+        runs[i].len = len1 + len2;
+        if(i == (int)runs.size() - 3) runs[i+1] = runs[i+2];
+        runs.pop_back();
+        // elements of run1 that are <= run2[0] are already in place
+        int k = gallop_right(a[base2], a + base1, len1, 0);
+        base1 += k;
+        len1 -= k;
+        if(len1 == 0) return;
+        // elements of run2 that are >= run1[-1] are already in place
+        len2 = gallop_left(a[base1 + len1 - 1], a + base2, len2, len2 - 1);
+        if(len2 == 0) return;
+        if(len1 <= len2) merge_lo(base1, len1, base2, len2);
+        else merge_hi(base1, len1, base2, len2);
+    }
+
+    void merge_collapse(){
+        while(runs.size() > 1){
+            int i = runs.size() - 2;
+            if((i > 0 && runs[i-1].len <= runs[i].len + runs[i+1].len) ||
+               (i > 1 && runs[i-2].len <= runs[i-1].len + runs[i].len)){
+                if(runs[i-1].len < runs[i+1].len) i--;
+            }else if(runs[i].len > runs[i+1].len){
+                break;
+            }
+            merge_at(i);
+        }
+    }
+
+    void merge_force_collapse(){
+        while(runs.size() > 1){
+            int i = runs.size() - 2;
+            if(i > 0 && runs[i-1].len < runs[i+1].len) i--;
+            merge_at(i);
+        }
+    }
+
+    void sort(){
+        if(n < 2) return;
+        int minrun = min_run(n);
+        int lo = 0;
+        int remaining = n;
+        while(remaining > 0){
+            int run_len = count_run(lo, n);
+            if(run_len < minrun){
+                int force = remaining <= minrun ? remaining : minrun;
+                binary_insertion_sort(lo, lo + force, lo + run_len);
+                run_len = force;
+            }
+            runs.push_back({lo, run_len});
+            merge_collapse();
+            lo += run_len;
+            remaining -= run_len;
+        }
+        merge_force_collapse();
+    }
+};
+
+template<typename T, typename Less>
+void timsort(T* a, int n, Less less){
+    TimSort<T, Less> ts(a, n, less);
+    ts.sort();
+}
+
+}   // namespace pkpy
@@ -10,6 +10,7 @@
 #include "str.h"
 #include "tuplelist.h"
 #include "dict.h"
+#include "bigint.h"
 
 namespace pkpy{
 
@@ -48,12 +49,24 @@ namespace pkpy{
 
 typedef PyObject* (*BinaryFuncC)(VM*, PyObject*, PyObject*);
 
+#if PK_DEBUG_OPCODE_PAIRS
+struct OpcodePairCounter{
+    static constexpr int N = sizeof(OP_NAMES) / sizeof(OP_NAMES[0]);
+    i64 counts[N][N] = {};
+    uint16_t prev = OP_NO_OP;
+
+    void record(uint16_t op){ counts[prev][op]++; prev = op; }
+    ~OpcodePairCounter();
+};
+#endif
+
 struct PyTypeInfo{
     PyObject* obj;      // never be garbage collected
     Type base;
     PyObject* mod;      // never be garbage collected
     Str name;
     bool subclass_enabled;
+    unsigned int version = 0;   // bumped when the attributes of this type or its bases change
 
     // cached special methods
     // unary operators
@@ -116,6 +129,7 @@ public:
     ValueStack s_data;
     stack< Frame > callstack;
     std::vector<PyTypeInfo> _all_types;
+    unsigned int _type_version = 0;                    // source of PyTypeInfo::version
     
     NameDict _modules;                                 // loaded modules
     std::map<StrName, Str> _lazy_modules;              // lazy loaded modules
@@ -140,9 +154,16 @@ public:
     void (*_ceval_on_step)(VM*, Frame*, Bytecode bc) = nullptr;
 #endif
 
+#if PK_DEBUG_OPCODE_PAIRS
+    inline static OpcodePairCounter _op_pairs;
+#endif
+
     PrintFunc _stdout;
     PrintFunc _stderr;
     Bytes (*_import_handler)(const Str& name);
+    // bytecode cache of the modules found by `_import_handler`, disabled if nullptr
+    Bytes (*_bytecode_cache_loader)(const Str& name) = nullptr;
+    void (*_bytecode_cache_writer)(const Str& name, const Bytes& data) = nullptr;
 
     // for quick access
     Type tp_object, tp_type, tp_int, tp_float, tp_bool, tp_str;
@@ -151,6 +172,8 @@ public:
     Type tp_slice, tp_range, tp_module;
     Type tp_super, tp_exception, tp_bytes, tp_mappingproxy;
     Type tp_dict, tp_property, tp_star_wrapper;
+    Type tp_set, tp_frozenset, tp_long, tp_cell;
+    Type tp_generator;
 
     PyObject* cached_object__new__;
 
@@ -307,6 +330,8 @@ public:
     }
 
     bool py_equals(PyObject* lhs, PyObject* rhs);
+    bool py_lt(PyObject* lhs, PyObject* rhs);
+    PyObject* py_add(PyObject* lhs, PyObject* rhs);
 
     template<int ARGC>
     PyObject* bind_func(Str type, Str name, NativeFuncC fn) {
@@ -453,6 +478,11 @@ public:
     void parse_int_slice(const Slice& s, int length, int& start, int& stop, int& step);
     PyObject* format(Str, PyObject*);
     void setattr(PyObject* obj, StrName name, PyObject* value);
+    void _type_modified(Type type);
+    void _fill_attr_cache(AttrCache& cache, Type type, StrName name);
+    PyObject* _getattr_cached(AttrCache& cache, PyObject* obj, StrName name);
+    PyObject* _get_unbound_method_cached(AttrCache& cache, PyObject* obj, StrName name, PyObject** self);
+    void _setattr_cached(AttrCache& cache, PyObject* obj, StrName name, PyObject* value);
     template<int ARGC>
     PyObject* bind_method(PyObject*, Str, NativeFuncC);
     template<int ARGC>
@@ -482,6 +512,9 @@ DEF_NATIVE_2(MappingProxy, tp_mappingproxy)
 DEF_NATIVE_2(Dict, tp_dict)
 DEF_NATIVE_2(Property, tp_property)
 DEF_NATIVE_2(StarWrapper, tp_star_wrapper)
+DEF_NATIVE_2(Set, tp_set)
+DEF_NATIVE_2(BigInt, tp_long)
+DEF_NATIVE_2(Cell, tp_cell)
 
 #undef DEF_NATIVE_2
 
@@ -522,7 +555,8 @@ template<> inline float _py_cast<float>(VM* vm, PyObject* obj){
 template<> inline double py_cast<double>(VM* vm, PyObject* obj){
     if(is_float(obj)) return untag_float(obj);
     i64 bits;
-    if(try_cast_int(obj, &bits)) return (float)bits;
+    if(try_cast_int(obj, &bits)) return (double)bits;
+    if(is_non_tagged_type(obj, vm->tp_long)) return PK_OBJ_GET(BigInt, obj).to_f64();
     vm->TypeError("expected 'int' or 'float', got " + OBJ_NAME(vm->_t(obj)).escape());
     return 0;
 }
@@ -624,6 +658,7 @@ PyObject* VM::bind_method(PyObject* obj, Str name, NativeFuncC fn) {
     check_non_tagged_type(obj, tp_type);
     PyObject* nf = VAR(NativeFunc(fn, ARGC, true));
     obj->attr().set(name, nf);
+    _type_modified(PK_OBJ_GET(Type, obj));
     return nf;
 }
 
@@ -631,6 +666,8 @@ template<int ARGC>
 PyObject* VM::bind_func(PyObject* obj, Str name, NativeFuncC fn) {
     PyObject* nf = VAR(NativeFunc(fn, ARGC, false));
     obj->attr().set(name, nf);
+    heap.write_barrier(obj);
+    if(is_non_tagged_type(obj, tp_type)) _type_modified(PK_OBJ_GET(Type, obj));
     return nf;
 }
 
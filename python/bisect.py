@@ -70,3 +70,10 @@ def bisect_left(a, x, lo=0, hi=None):
 # Create aliases
 bisect = bisect_right
 insort = insort_right
+
+
+# use the native implementation when it is built in
+try:
+    from _bisect import *
+except ImportError:
+    pass
@@ -4,44 +4,6 @@ def print(*args, sep=' ', end='\n'):
     s = sep.join([str(i) for i in args])
     _sys.stdout.write(s + end)
 
-def max(*args, key=None):
-    if key is None:
-        key = lambda x: x
-    if len(args) == 0:
-        raise TypeError('max expected 1 arguments, got 0')
-    if len(args) == 1:
-        args = args[0]
-    args = iter(args)
-    res = next(args)
-    if res is StopIteration:
-        raise ValueError('max() arg is an empty sequence')
-    while True:
-        i = next(args)
-        if i is StopIteration:
-            break
-        if key(i) > key(res):
-            res = i
-    return res
-
-def min(*args, key=None):
-    if key is None:
-        key = lambda x: x
-    if len(args) == 0:
-        raise TypeError('min expected 1 arguments, got 0')
-    if len(args) == 1:
-        args = args[0]
-    args = iter(args)
-    res = next(args)
-    if res is StopIteration:
-        raise ValueError('min() arg is an empty sequence')
-    while True:
-        i = next(args)
-        if i is StopIteration:
-            break
-        if key(i) < key(res):
-            res = i
-    return res
-
 def all(iterable):
     for i in iterable:
         if not i:
@@ -54,42 +16,6 @@ def any(iterable):
             return True
     return False
 
-def enumerate(iterable, start=0):
-    n = start
-    for elem in iterable:
-        yield n, elem
-        ++n
-
-def sum(iterable):
-    res = 0
-    for i in iterable:
-        res += i
-    return res
-
-def map(f, iterable):
-    for i in iterable:
-        yield f(i)
-
-def filter(f, iterable):
-    for i in iterable:
-        if f(i):
-            yield i
-
-def zip(a, b):
-    a = iter(a)
-    b = iter(b)
-    while True:
-        ai = next(a)
-        bi = next(b)
-        if ai is StopIteration or bi is StopIteration:
-            break
-        yield ai, bi
-
-def reversed(iterable):
-    a = list(iterable)
-    a.reverse()
-    return a
-
 def sorted(iterable, reverse=False, key=None):
     a = list(iterable)
     a.sort(reverse=reverse, key=key)
@@ -258,28 +184,6 @@ def __f(self, width: int, fillchar=' '):
 str.ljust = __f
 
 ##### list #####
-def __qsort(a: list, L: int, R: int, key):
-    if L >= R: return;
-    mid = a[(R+L)//2];
-    mid = key(mid)
-    i, j = L, R
-    while i<=j:
-        while key(a[i])<mid: ++i;
-        while key(a[j])>mid: --j;
-        if i<=j:
-            a[i], a[j] = a[j], a[i]
-            ++i; --j;
-    __qsort(a, L, j, key)
-    __qsort(a, i, R, key)
-
-def __f(self, reverse=False, key=None):
-    if key is None:
-        key = lambda x:x
-    __qsort(self, 0, len(self)-1, key)
-    if reverse:
-        self.reverse()
-list.sort = __f
-
 def __f(self, other):
     for i, j in zip(self, other):
         if i != j:
@@ -325,4 +229,3 @@ del __f
 
 class Exception: pass
 
-from _long import long
\ No newline at end of file
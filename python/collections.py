@@ -158,3 +158,10 @@ class defaultdict:
 
     def pop(self, *args):
         return self._a.pop(*args)
+
+
+# use the native ring buffer when it is built in
+try:
+    from _collections import deque
+except ImportError:
+    pass
@@ -83,4 +83,10 @@ def _siftup(heap, pos):
     # The leaf at pos is empty now.  Put newitem there, and bubble it up
     # to its final resting place (by sifting its parents down).
     heap[pos] = newitem
-    _siftdown(heap, startpos, pos)
\ No newline at end of file
+    _siftdown(heap, startpos, pos)
+
+# use the native implementation when it is built in
+try:
+    from _heapq import *
+except ImportError:
+    pass
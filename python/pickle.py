@@ -64,6 +64,10 @@ class _Pickler:
             ret.append("dict")
             ret.append([[self.wrap(k), self.wrap(v)] for k,v in o.items()])
             return [index]
+        if type(o) is set or type(o) is frozenset:
+            ret.append(type(o).__name__)
+            ret.append([self.wrap(i) for i in o])
+            return [index]
         
         _0 = self._type_id(type(o))
 
@@ -143,6 +147,16 @@ class _Unpickler:
             for k,v in o[1]:
                 ret[self.unwrap(k)] = self.unwrap(v)
             return ret
+        if o[0] == "set":
+            ret = set()
+            self.tag(index, ret)
+            for i in o[1]:
+                ret.add(self.unwrap(i))
+            return ret
+        if o[0] == "frozenset":
+            ret = frozenset([self.unwrap(i) for i in o[1]])
+            self.tag(index, ret)
+            return ret
         
         # generic object
         cls, newargs, state = o
@@ -0,0 +1,4 @@
+python3 prebuild.py
+SRC=$(find src/ -name "*.cpp")
+g++ -O2 -std=c++17 -DPK_DEBUG_OPCODE_PAIRS=1 -Wfatal-errors -o main $SRC src2/main.cpp -Iinclude -ldl
+python3 scripts/opcode_pairs.py $@
@@ -0,0 +1,32 @@
+import os
+import sys
+import subprocess
+
+# usage: python3 scripts/opcode_pairs.py [top_n]
+# `./main` must be built with PK_DEBUG_OPCODE_PAIRS=1, see `run_opcode_pairs.sh`
+
+top_n = int(sys.argv[1]) if len(sys.argv) == 2 else 30
+exe = 'main.exe' if sys.platform == 'win32' else './main'
+
+counts = {}
+for d in ['tests/', 'benchmarks/']:
+    for filename in sorted(os.listdir(d)):
+        if not filename.endswith('.py'):
+            continue
+        filepath = os.path.join(d, filename)
+        print("> " + filepath, file=sys.stderr, flush=True)
+        res = subprocess.run([exe, filepath], stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        for line in res.stderr.splitlines():
+            if not line.startswith('[opcode_pairs] '):
+                continue
+            _, a, b, n = line.split()
+            counts[(a, b)] = counts.get((a, b), 0) + int(n)
+
+total = sum(counts.values())
+if total == 0:
+    print('no opcode pairs recorded, is PK_DEBUG_OPCODE_PAIRS enabled?')
+    exit(1)
+
+print(f'{"pair":<48}{"count":>14}{"share":>9}')
+for (a, b), n in sorted(counts.items(), key=lambda x: -x[1])[:top_n]:
+    print(f'{a + " " + b:<48}{n:>14}{n / total * 100:>8.2f}%')
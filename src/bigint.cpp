@@ -0,0 +1,550 @@
+#include "pocketpy/bigint.h"
+
+namespace pkpy{
+
+using limb_t = BigInt::limb_t;
+using Limbs = std::vector<limb_t>;
+
+static const limb_t kDecimalBase = 1000000000;     // 10**9, the largest power of 10 in a limb
+static const int kDecimalDigits = 9;
+
+static void _trim(Limbs& a){
+    while(!a.empty() && a.back() == 0) a.pop_back();
+}
+
+static int _clz32(limb_t x){
+    int n = 0;
+    while(!(x & 0x80000000u)){ x <<= 1; n++; }
+    return n;
+}
+
+static int _cmp_abs(const Limbs& a, const Limbs& b){
+    if(a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    for(int i=(int)a.size()-1; i>=0; i--){
+        if(a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+static Limbs _add_abs(const Limbs& a, const Limbs& b){
+    const Limbs& x = a.size() >= b.size() ? a : b;
+    const Limbs& y = a.size() >= b.size() ? b : a;
+    Limbs r(x.size() + 1);
+    uint64_t carry = 0;
+    size_t i = 0;
+    for(; i<y.size(); i++){
+        carry += (uint64_t)x[i] + y[i];
+        r[i] = (limb_t)carry;
+        carry >>= 32;
+    }
+    for(; i<x.size(); i++){
+        carry += x[i];
+        r[i] = (limb_t)carry;
+        carry >>= 32;
+    }
+    r[i] = (limb_t)carry;
+    _trim(r);
+    return r;
+}
+
+// requires |a| >= |b|
+static Limbs _sub_abs(const Limbs& a, const Limbs& b){
+    Limbs r(a.size());
+    i64 borrow = 0;
+    for(size_t i=0; i<a.size(); i++){
+        i64 t = (i64)a[i] - borrow - (i < b.size() ? (i64)b[i] : 0);
+        r[i] = (limb_t)t;
+        borrow = t < 0;
+    }
+    _trim(r);
+    return r;
+}
+
+// dst[0, n) += src[0, m), where m <= n and the sum fits in `dst`
+static void _add_into(limb_t* dst, int n, const limb_t* src, int m){
+    uint64_t carry = 0;
+    int i = 0;
+    for(; i<m; i++){
+        carry += (uint64_t)dst[i] + src[i];
+        dst[i] = (limb_t)carry;
+        carry >>= 32;
+    }
+    for(; carry && i<n; i++){
+        carry += dst[i];
+        dst[i] = (limb_t)carry;
+        carry >>= 32;
+    }
+}
+
+// dst[0, n) -= src[0, m), where m <= n and the difference is not negative
+static void _sub_from(limb_t* dst, int n, const limb_t* src, int m){
+    i64 borrow = 0;
+    int i = 0;
+    for(; i<m; i++){
+        i64 t = (i64)dst[i] - src[i] - borrow;
+        dst[i] = (limb_t)t;
+        borrow = t < 0;
+    }
+    for(; borrow && i<n; i++){
+        i64 t = (i64)dst[i] - borrow;
+        dst[i] = (limb_t)t;
+        borrow = t < 0;
+    }
+}
+
+// out[0, n+m) must be zeroed
+static void _mul_school(const limb_t* a, int n, const limb_t* b, int m, limb_t* out){
+    for(int i=0; i<n; i++){
+        uint64_t ai = a[i];
+        if(ai == 0) continue;
+        uint64_t carry = 0;
+        for(int j=0; j<m; j++){
+            carry += ai * b[j] + out[i+j];
+            out[i+j] = (limb_t)carry;
+            carry >>= 32;
+        }
+        out[i+m] = (limb_t)carry;
+    }
+}
+
+// out[0, n+m) = a * b, `out` must not overlap the operands
+static void _mul_abs(const limb_t* a, int n, const limb_t* b, int m, limb_t* out){
+    if(n < m){ std::swap(a, b); std::swap(n, m); }
+    std::fill(out, out + n + m, 0);
+    if(m == 0) return;
+    if(m < BigInt::kKaratsubaThreshold){
+        _mul_school(a, n, b, m, out);
+        return;
+    }
+    if(n >= 2 * m){
+        // unbalanced, multiply `b` by each m-limb slice of `a`
+        Limbs tmp(2 * m);
+        for(int i=0; i<n; i+=m){
+            int len = std::min(m, n - i);
+            _mul_abs(a + i, len, b, m, tmp.data());
+            _add_into(out + i, n + m - i, tmp.data(), len + m);
+        }
+        return;
+    }
+    // Karatsuba, a = a1*B^k + a0 and b = b1*B^k + b0 where k < m <= n
+    int k = n / 2;
+    _mul_abs(a, k, b, k, out);                          // z0 = a0*b0
+    _mul_abs(a + k, n - k, b + k, m - k, out + 2*k);    // z2 = a1*b1
+    int la = n - k + 1;
+    Limbs sa(la, 0);
+    std::copy(a + k, a + n, sa.begin());
+    _add_into(sa.data(), la, a, k);
+    int lb = std::max(k, m - k) + 1;
+    Limbs sb(lb, 0);
+    std::copy(b + k, b + m, sb.begin());
+    _add_into(sb.data(), lb, b, k);
+    // z1 = (a0+a1)*(b0+b1) - z0 - z2
+    Limbs z1(la + lb);
+    _mul_abs(sa.data(), la, sb.data(), lb, z1.data());
+    _sub_from(z1.data(), la + lb, out, 2*k);
+    _sub_from(z1.data(), la + lb, out + 2*k, n + m - 2*k);
+    _trim(z1);
+    _add_into(out + k, n + m - k, z1.data(), (int)z1.size());
+}
+
+// a = a * mul + add
+static void _mul_small_add(Limbs& a, limb_t mul, limb_t add){
+    uint64_t carry = add;
+    for(limb_t& x: a){
+        carry += (uint64_t)x * mul;
+        x = (limb_t)carry;
+        carry >>= 32;
+    }
+    if(carry) a.push_back((limb_t)carry);
+}
+
+// a = a / v, returns a % v
+static limb_t _divmod_small(Limbs& a, limb_t v){
+    uint64_t rem = 0;
+    for(int i=(int)a.size()-1; i>=0; i--){
+        uint64_t cur = (rem << 32) | a[i];
+        a[i] = (limb_t)(cur / v);
+        rem = cur % v;
+    }
+    _trim(a);
+    return (limb_t)rem;
+}
+
+// Knuth's algorithm D, see Hacker's Delight 9-2 `divmnu`
+static void _divmod_abs(const Limbs& a, const Limbs& b, Limbs& q, Limbs& r){
+    if(_cmp_abs(a, b) < 0){
+        q.clear();
+        r = a;
+        return;
+    }
+    if(b.size() == 1){
+        q = a;
+        limb_t rem = _divmod_small(q, b[0]);
+        r.clear();
+        if(rem) r.push_back(rem);
+        return;
+    }
+    const uint64_t B = 1ull << 32;
+    int n = b.size(), m = a.size();
+    // normalize so that the top bit of the divisor is set
+    int s = _clz32(b.back());
+    Limbs vn(n), un(m + 1);
+    for(int i=n-1; i>0; i--) vn[i] = (b[i] << s) | (limb_t)((uint64_t)b[i-1] >> (32 - s));
+    vn[0] = b[0] << s;
+    un[m] = (limb_t)((uint64_t)a[m-1] >> (32 - s));
+    for(int i=m-1; i>0; i--) un[i] = (a[i] << s) | (limb_t)((uint64_t)a[i-1] >> (32 - s));
+    un[0] = a[0] << s;
+
+    q.assign(m - n + 1, 0);
+    for(int j=m-n; j>=0; j--){
+        uint64_t num = ((uint64_t)un[j+n] << 32) | un[j+n-1];
+        uint64_t qhat = num / vn[n-1];
+        uint64_t rhat = num % vn[n-1];
+        while(qhat >= B || qhat * vn[n-2] > ((rhat << 32) | un[j+n-2])){
+            qhat--;
+            rhat += vn[n-1];
+            if(rhat >= B) break;
+        }
+        // multiply and subtract
+        i64 k = 0, t;
+        for(int i=0; i<n; i++){
+            uint64_t p = qhat * vn[i];
+            t = (i64)un[i+j] - k - (i64)(p & 0xFFFFFFFF);
+            un[i+j] = (limb_t)t;
+            k = (i64)(p >> 32) - (t >> 32);
+        }
+        t = (i64)un[j+n] - k;
+        un[j+n] = (limb_t)t;
+        q[j] = (limb_t)qhat;
+        if(t < 0){
+            // subtracted too much, add back
+            q[j]--;
+            uint64_t carry = 0;
+            for(int i=0; i<n; i++){
+                carry += (uint64_t)un[i+j] + vn[i];
+                un[i+j] = (limb_t)carry;
+                carry >>= 32;
+            }
+            un[j+n] += (limb_t)carry;
+        }
+    }
+    // unnormalize the remainder
+    r.assign(n, 0);
+    for(int i=0; i<n-1; i++) r[i] = (un[i] >> s) | (limb_t)((uint64_t)un[i+1] << (32 - s));
+    r[n-1] = un[n-1] >> s;
+    _trim(q);
+    _trim(r);
+}
+
+static Limbs _shl_abs(const Limbs& a, i64 n){
+    if(a.empty()) return a;
+    size_t limbs = n / 32;
+    int bits = n % 32;
+    Limbs r(limbs, 0);
+    r.reserve(limbs + a.size() + 1);
+    limb_t carry = 0;
+    for(limb_t x: a){
+        r.push_back((x << bits) | carry);
+        carry = bits ? x >> (32 - bits) : 0;
+    }
+    if(carry) r.push_back(carry);
+    return r;
+}
+
+static Limbs _shr_abs(const Limbs& a, i64 n){
+    size_t limbs = n / 32;
+    int bits = n % 32;
+    if(limbs >= a.size()) return {};
+    Limbs r(a.size() - limbs);
+    for(size_t i=0; i<r.size(); i++){
+        uint64_t x = a[i + limbs];
+        if(i + limbs + 1 < a.size()) x |= (uint64_t)a[i + limbs + 1] << 32;
+        r[i] = (limb_t)(x >> bits);
+    }
+    _trim(r);
+    return r;
+}
+
+// two's complement in `len` limbs, `len` must leave room for the sign bit
+static Limbs _to_twos(const BigInt& x, size_t len){
+    Limbs r = x.d;
+    r.resize(len, 0);
+    if(x.neg){
+        for(limb_t& l: r) l = ~l;
+        for(limb_t& l: r){ if(++l != 0) break; }
+    }
+    return r;
+}
+
+static BigInt _from_twos(Limbs&& r){
+    BigInt ret;
+    if(!r.empty() && (r.back() & 0x80000000u)){
+        ret.neg = true;
+        for(limb_t& l: r) l = ~l;
+        for(limb_t& l: r){ if(++l != 0) break; }
+    }
+    ret.d = std::move(r);
+    ret._trim();
+    return ret;
+}
+
+/*************** BigInt ***************/
+BigInt::BigInt(i64 value){
+    neg = value < 0;
+    uint64_t u = neg ? 0 - (uint64_t)value : (uint64_t)value;
+    while(u){
+        d.push_back((limb_t)u);
+        u >>= 32;
+    }
+}
+
+BigInt BigInt::from_f64(f64 value){
+    value = std::trunc(value);
+    if(std::abs(value) < 9.2e18) return BigInt((i64)value);
+    int exp;
+    f64 m = std::frexp(std::abs(value), &exp);
+    // the 53-bit mantissa is exact, shift it into place
+    BigInt ret = BigInt((i64)std::ldexp(m, 53)) << (exp - 53);
+    if(value < 0) ret.neg = true;
+    return ret;
+}
+
+bool BigInt::from_str(std::string_view s, BigInt& out){
+    static const limb_t kPow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    // a trailing `L` is allowed, so the repr of a `long` can be parsed back
+    if(!s.empty() && s.back() == 'L') s.remove_suffix(1);
+    size_t i = 0;
+    bool is_neg = false;
+    if(i < s.size() && (s[i] == '+' || s[i] == '-')){
+        is_neg = s[i] == '-';
+        i++;
+    }
+    if(i == s.size()) return false;
+    BigInt ret;
+    // the first chunk takes the leftover digits, so the others have 9 digits each
+    int chunk_size = (s.size() - i) % kDecimalDigits;
+    if(chunk_size == 0) chunk_size = kDecimalDigits;
+    while(i < s.size()){
+        limb_t chunk = 0;
+        for(int j=0; j<chunk_size; j++){
+            char c = s[i++];
+            if(c < '0' || c > '9') return false;
+            chunk = chunk * 10 + (c - '0');
+        }
+        _mul_small_add(ret.d, kPow10[chunk_size], chunk);
+        chunk_size = kDecimalDigits;
+    }
+    ret.neg = is_neg;
+    ret._trim();
+    out = std::move(ret);
+    return true;
+}
+
+bool BigInt::to_i64(i64* out) const{
+    if(d.size() > 2) return false;
+    uint64_t u = 0;
+    if(d.size() > 0) u |= d[0];
+    if(d.size() > 1) u |= (uint64_t)d[1] << 32;
+    if(neg){
+        if(u > (uint64_t)INT64_MAX + 1) return false;
+        *out = (i64)(0 - u);
+    }else{
+        if(u > (uint64_t)INT64_MAX) return false;
+        *out = (i64)u;
+    }
+    return true;
+}
+
+f64 BigInt::to_f64() const{
+    f64 ret = 0;
+    for(int i=(int)d.size()-1; i>=0; i--) ret = ret * 4294967296.0 + d[i];
+    return neg ? -ret : ret;
+}
+
+std::string BigInt::to_string() const{
+    if(d.empty()) return "0";
+    Limbs t = d;
+    std::vector<limb_t> chunks;
+    chunks.reserve(d.size() * 32 / 29 + 1);
+    while(!t.empty()) chunks.push_back(_divmod_small(t, kDecimalBase));
+    std::string ret;
+    ret.reserve(chunks.size() * kDecimalDigits + 1);
+    if(neg) ret.push_back('-');
+    ret += std::to_string(chunks.back());
+    char buf[16];
+    for(int i=(int)chunks.size()-2; i>=0; i--){
+        snprintf(buf, sizeof(buf), "%09u", (unsigned)chunks[i]);
+        ret += buf;
+    }
+    return ret;
+}
+
+i64 BigInt::hash() const{
+    // equal to the hash of an `int` if the value fits in one
+    i64 val;
+    if(to_i64(&val)) return val;
+    uint64_t h = neg ? 0xcbf29ce484222325ull : 0x84222325cbf29ce4ull;
+    for(limb_t x: d) h = (h ^ x) * 0x100000001b3ull;
+    return (i64)h;
+}
+
+i64 BigInt::bit_length() const{
+    if(d.empty()) return 0;
+    return (i64)(d.size() - 1) * kLimbBits + (kLimbBits - _clz32(d.back()));
+}
+
+int BigInt::cmp(const BigInt& other) const{
+    if(neg != other.neg) return neg ? -1 : 1;
+    int c = _cmp_abs(d, other.d);
+    return neg ? -c : c;
+}
+
+BigInt BigInt::operator-() const{
+    BigInt ret = *this;
+    if(!ret.d.empty()) ret.neg = !neg;
+    return ret;
+}
+
+BigInt BigInt::abs() const{
+    BigInt ret = *this;
+    ret.neg = false;
+    return ret;
+}
+
+static BigInt _add_signed(const BigInt& a, const Limbs& b, bool b_neg){
+    BigInt ret;
+    if(a.neg == b_neg){
+        ret.d = _add_abs(a.d, b);
+        ret.neg = a.neg;
+    }else{
+        int c = _cmp_abs(a.d, b);
+        if(c == 0) return ret;
+        if(c > 0){
+            ret.d = _sub_abs(a.d, b);
+            ret.neg = a.neg;
+        }else{
+            ret.d = _sub_abs(b, a.d);
+            ret.neg = b_neg;
+        }
+    }
+    ret._trim();
+    return ret;
+}
+
+BigInt BigInt::operator+(const BigInt& other) const{
+    return _add_signed(*this, other.d, other.neg);
+}
+
+BigInt BigInt::operator-(const BigInt& other) const{
+    return _add_signed(*this, other.d, !other.neg);
+}
+
+BigInt BigInt::operator*(const BigInt& other) const{
+    BigInt ret;
+    if(d.empty() || other.d.empty()) return ret;
+    ret.d.resize(d.size() + other.d.size());
+    _mul_abs(d.data(), d.size(), other.d.data(), other.d.size(), ret.d.data());
+    ret.neg = neg != other.neg;
+    ret._trim();
+    return ret;
+}
+
+void BigInt::divmod(const BigInt& a, const BigInt& b, BigInt& q, BigInt& r){
+    PK_ASSERT(!b.is_zero());
+    // `q` or `r` may alias an operand
+    BigInt _q, _r;
+    _divmod_abs(a.d, b.d, _q.d, _r.d);
+    _q.neg = a.neg != b.neg;
+    _r.neg = a.neg;
+    _q._trim();
+    _r._trim();
+    if(!_r.is_zero() && _r.neg != b.neg){
+        _q = _q - BigInt(1);
+        _r = _r + b;
+    }
+    q = std::move(_q);
+    r = std::move(_r);
+}
+
+BigInt BigInt::pow(i64 exp) const{
+    PK_ASSERT(exp >= 0);
+    BigInt ret(1);
+    BigInt base = *this;
+    while(exp){
+        if(exp & 1) ret = ret * base;
+        exp >>= 1;
+        if(exp) base = base * base;
+    }
+    return ret;
+}
+
+BigInt BigInt::pow_mod(const BigInt& base, const BigInt& exp, const BigInt& mod){
+    PK_ASSERT(!exp.neg && !mod.is_zero());
+    BigInt q, b;
+    divmod(base, mod, q, b);
+    BigInt ret(1);
+    for(size_t i=0; i<exp.d.size(); i++){
+        limb_t e = exp.d[i];
+        bool last = i == exp.d.size() - 1;
+        for(int bit=0; bit<kLimbBits; bit++){
+            if(last && (e >> bit) == 0) break;
+            if((e >> bit) & 1) divmod(ret * b, mod, q, ret);
+            divmod(b * b, mod, q, b);
+        }
+    }
+    // `1 % mod` if `exp` is 0
+    divmod(ret, mod, q, ret);
+    return ret;
+}
+
+BigInt BigInt::operator<<(i64 n) const{
+    PK_ASSERT(n >= 0);
+    BigInt ret;
+    ret.d = _shl_abs(d, n);
+    ret.neg = neg;
+    return ret;
+}
+
+BigInt BigInt::operator>>(i64 n) const{
+    PK_ASSERT(n >= 0);
+    BigInt ret;
+    if(!neg){
+        ret.d = _shr_abs(d, n);
+        return ret;
+    }
+    // -((|x| - 1) >> n) - 1
+    ret.d = _shr_abs(_sub_abs(d, {1}), n);
+    ret.d = _add_abs(ret.d, {1});
+    ret.neg = true;
+    return ret;
+}
+
+BigInt BigInt::operator&(const BigInt& other) const{
+    size_t len = std::max(d.size(), other.d.size()) + 1;
+    Limbs a = _to_twos(*this, len);
+    Limbs b = _to_twos(other, len);
+    for(size_t i=0; i<len; i++) a[i] &= b[i];
+    return _from_twos(std::move(a));
+}
+
+BigInt BigInt::operator|(const BigInt& other) const{
+    size_t len = std::max(d.size(), other.d.size()) + 1;
+    Limbs a = _to_twos(*this, len);
+    Limbs b = _to_twos(other, len);
+    for(size_t i=0; i<len; i++) a[i] |= b[i];
+    return _from_twos(std::move(a));
+}
+
+BigInt BigInt::operator^(const BigInt& other) const{
+    size_t len = std::max(d.size(), other.d.size()) + 1;
+    Limbs a = _to_twos(*this, len);
+    Limbs b = _to_twos(other, len);
+    for(size_t i=0; i<len; i++) a[i] ^= b[i];
+    return _from_twos(std::move(a));
+}
+
+BigInt BigInt::operator~() const{
+    return -*this - BigInt(1);
+}
+
+}   // namespace pkpy
@@ -6,10 +6,31 @@ static i64 _py_sint(PyObject* obj) noexcept {
     return (i64)(PK_BITS(obj) >> 2);
 }
 
+static bool _is_number(PyObject* obj) noexcept {
+    return is_float(obj) || is_small_int(obj);
+}
+
+// both are numbers and at least one of them is a float
+static bool _is_float_pair(PyObject* a, PyObject* b) noexcept {
+    return _is_number(a) && _is_number(b) && (is_float(a) || is_float(b));
+}
+
+static f64 _py_number(PyObject* obj) noexcept {
+    return is_float(obj) ? untag_float(obj) : (f64)_py_sint(obj);
+}
+
+// rewrite the instruction at `ip` in place
+static void _quicken(const CodeObject* co, int ip, Opcode op, int arg=BC_NOARG) noexcept {
+    Bytecode& byte = const_cast<Bytecode&>(co->codes[ip]);
+    byte.op = op;
+    if(arg != BC_NOARG) byte.arg = arg;
+}
+
 PyObject* VM::_run_top_frame(){
     FrameId frame = top_frame();
     const int base_id = frame.index;
     bool need_raise = false;
+    bool need_unwind = false;
 
     // shared registers
     PyObject *_0, *_1, *_2;
@@ -21,7 +42,6 @@ PyObject* VM::_run_top_frame(){
         if(frame.index < base_id) FATAL_ERROR();
 #endif
         try{
-            if(need_raise){ need_raise = false; _raise(); }
 /**********************************************************************/
 /* NOTE: 
  * Be aware of accidental gc!
@@ -31,11 +51,54 @@ PyObject* VM::_run_top_frame(){
 
 #if PK_ENABLE_CEVAL_CALLBACK
 #define CEVAL_STEP() byte = frame->next_bytecode(); if(_ceval_on_step) _ceval_on_step(this, frame.get(), byte)
+#elif PK_DEBUG_OPCODE_PAIRS
+#define CEVAL_STEP() byte = frame->next_bytecode(); _op_pairs.record(byte.generic().op)
 #else
 #define CEVAL_STEP() byte = frame->next_bytecode()
 #endif
 
 #define DISPATCH_OP_CALL() { frame = top_frame(); goto __NEXT_FRAME; }
+    if(need_raise){ need_raise = false; goto __RAISE; }
+    if(need_unwind){ need_unwind = false; goto __UNWIND; }
+    goto __NEXT_FRAME;
+
+/* NOTE:
+ * Exceptions raised by bytecodes are handled here without a C++ throw,
+ * so are the frames unwound within this call.
+ * A throw is only needed to leave this call or to leave native code.
+ */
+__RAISE: {
+        Exception& e = PK_OBJ_GET(Exception, TOP());
+        e._ip_on_error = frame->_ip;
+        e._code_on_error = (void*)frame->co;
+    }
+__RE_RAISE:
+    if(frame->jump_to_exception_handler()) goto __NEXT_FRAME;
+__UNWIND: {
+        PyObject* obj = POPX();
+        Exception& _e = CAST(Exception&, obj);
+        int actual_ip = frame->_ip;
+        if(_e._ip_on_error >= 0 && _e._code_on_error == (void*)frame->co) actual_ip = _e._ip_on_error;
+        int current_line = frame->co->lines[actual_ip];         // current line
+        auto current_f_name = frame->co->name.sv();             // current function name
+        if(frame->_callable == nullptr) current_f_name = "";    // not in a function
+        _e.st_push(frame->co->src->snapshot(current_line, nullptr, current_f_name));
+        if(frame->co->is_generator && frame.index != base_id){
+            PK_OBJ_GET(Generator, frame->_sp_base[-1]).state = 2;
+        }
+        _pop_frame();
+        if(callstack.empty()){
+#if PK_DEBUG_FULL_EXCEPTION
+            std::cerr << _e.summary() << std::endl;
+#endif
+            throw _e;
+        }
+        frame = top_frame();
+        PUSH(obj);
+        if(frame.index < base_id) break;
+    }
+    goto __RAISE;
+
 __NEXT_FRAME:
     Bytecode CEVAL_STEP();
     // cache
@@ -43,6 +106,8 @@ __NEXT_FRAME:
     const auto& co_consts = co->consts;
     const auto& co_blocks = co->blocks;
 
+#define QUICKEN(_op) _quicken(co, frame->_ip, OP_##_op)
+
 #if PK_ENABLE_COMPUTED_GOTO
 static void* OP_LABELS[] = {
     #define OPCODE(name) &&CASE_OP_##name,
@@ -52,11 +117,13 @@ static void* OP_LABELS[] = {
 
 #define DISPATCH() { CEVAL_STEP(); goto *OP_LABELS[byte.op];}
 #define TARGET(op) CASE_OP_##op:
+#define DEOPTIMIZE(_op) { QUICKEN(_op); byte.op = OP_##_op; goto *OP_LABELS[byte.op]; }
 goto *OP_LABELS[byte.op];
 
 #else
 #define TARGET(op) case OP_##op:
 #define DISPATCH() { CEVAL_STEP(); goto __NEXT_STEP;}
+#define DEOPTIMIZE(_op) { QUICKEN(_op); byte.op = OP_##_op; goto __NEXT_STEP; }
 
 __NEXT_STEP:;
 #if PK_DEBUG_CEVAL_STEP
@@ -91,18 +158,20 @@ __NEXT_STEP:;
     TARGET(LOAD_INTEGER) PUSH(VAR(byte.arg)); DISPATCH();
     TARGET(LOAD_ELLIPSIS) PUSH(Ellipsis); DISPATCH();
     TARGET(LOAD_FUNCTION) {
-        FuncDecl_ decl = co->func_decls[byte.arg];
-        PyObject* obj;
-        if(decl->nested){
-            NameDict_ captured = frame->_locals.to_namedict();
-            obj = VAR(Function({decl, frame->_module, captured}));
-            captured->set(decl->code->name, obj);
+        const FuncDecl_& decl = co->func_decls[byte.arg];
+        const pod_vector<FreeVar>& freevars = decl->code->freevars;
+        if(freevars.empty()){
+            PUSH(VAR(Function({decl, frame->_module})));
         }else{
-            obj = VAR(Function({decl, frame->_module}));
+            // share the cells of the enclosing frame
+            Tuple closure(freevars.size());
+            for(int i=0; i<freevars.size(); i++) closure[i] = frame->_locals[freevars[i].source];
+            _0 = VAR(std::move(closure));
+            PUSH(VAR(Function({decl, frame->_module, _0})));
         }
-        PUSH(obj);
     } DISPATCH();
     TARGET(LOAD_NULL) PUSH(PY_NULL); DISPATCH();
+    TARGET(LOAD_KWARG_NAME) PUSH(VAR(byte.arg)); DISPATCH();
     /*****************************************/
     TARGET(LOAD_FAST) {
         heap._auto_collect();
@@ -110,33 +179,59 @@ __NEXT_STEP:;
         if(_0 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg]);
         PUSH(_0);
     } DISPATCH();
+    TARGET(LOAD_FAST_LOAD_FAST) {
+        heap._auto_collect();
+        _0 = frame->_locals[byte.arg >> 16];
+        if(_0 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg >> 16]);
+        _1 = frame->_locals[byte.arg & 0xFFFF];
+        if(_1 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg & 0xFFFF]);
+        PUSH(_0);
+        PUSH(_1);
+    } DISPATCH();
+    TARGET(LOAD_FAST_LOAD_INTEGER) {
+        heap._auto_collect();
+        _0 = frame->_locals[byte.arg >> 16];
+        if(_0 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg >> 16]);
+        PUSH(_0);
+        PUSH(VAR((int16_t)(byte.arg & 0xFFFF)));
+    } DISPATCH();
+    TARGET(LOAD_FAST_LOAD_ATTR) {
+        heap._auto_collect();
+        _0 = frame->_locals[byte.arg >> 16];
+        if(_0 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg >> 16]);
+        PUSH(_getattr_cached(co->attr_caches[frame->_ip], _0, StrName(byte.arg & 0xFFFF)));
+    } DISPATCH();
     TARGET(LOAD_NAME) {
         heap._auto_collect();
         _name = StrName(byte.arg);
         PyObject** slot = frame->_locals.try_get_name(_name);
         if(slot != nullptr) {
-            if(*slot == PY_NULL) vm->UnboundLocalError(_name);
-            PUSH(*slot);
+            _0 = *slot;
+            if(is_non_tagged_type(_0, tp_cell)) _0 = PK_OBJ_GET(Cell, _0).value;
+            if(_0 == PY_NULL) vm->UnboundLocalError(_name);
+            PUSH(_0);
             DISPATCH();
         }
-        _0 = frame->f_closure_try_get(_name);
-        if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
         _0 = frame->f_globals().try_get(_name);
         if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
         _0 = vm->builtins->attr().try_get(_name);
         if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
         vm->NameError(_name);
     } DISPATCH();
-    TARGET(LOAD_NONLOCAL) {
+    TARGET(LOAD_DEREF) {
         heap._auto_collect();
-        _name = StrName(byte.arg);
-        _0 = frame->f_closure_try_get(_name);
-        if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
-        _0 = frame->f_globals().try_get(_name);
-        if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
-        _0 = vm->builtins->attr().try_get(_name);
-        if(_0 != nullptr) { PUSH(_0); DISPATCH(); }
-        vm->NameError(_name);
+        _0 = PK_OBJ_GET(Cell, frame->_locals[byte.arg]).value;
+        if(_0 == PY_NULL){
+            // a free variable unbound in the enclosing function is looked up as a global
+            bool is_free = false;
+            for(FreeVar fv: co->freevars) if(fv.index == byte.arg) is_free = true;
+            if(!is_free) vm->UnboundLocalError(co->varnames[byte.arg]);
+            _name = co->varnames[byte.arg];
+            _0 = frame->f_globals().try_get(_name);
+            if(_0 == nullptr) _0 = vm->builtins->attr().try_get(_name);
+            if(_0 == nullptr) vm->NameError(_name);
+        }
+        PUSH(_0);
     } DISPATCH();
     TARGET(LOAD_GLOBAL)
         heap._auto_collect();
@@ -148,13 +243,14 @@ __NEXT_STEP:;
         vm->NameError(_name);
         DISPATCH();
     TARGET(LOAD_ATTR)
-        TOP() = getattr(TOP(), StrName(byte.arg));
+        TOP() = _getattr_cached(co->attr_caches[frame->_ip], TOP(), StrName(byte.arg));
         DISPATCH();
     TARGET(LOAD_METHOD)
-        TOP() = get_unbound_method(TOP(), StrName(byte.arg), &_0, true, true);
+        TOP() = _get_unbound_method_cached(co->attr_caches[frame->_ip], TOP(), StrName(byte.arg), &_0);
         PUSH(_0);
         DISPATCH();
     TARGET(LOAD_SUBSCR)
+        if(is_small_int(TOP()) && is_non_tagged_type(SECOND(), tp_list)) QUICKEN(LOAD_SUBSCR_LIST_INT);
         _1 = POPX();    // b
         _0 = TOP();     // a
         _ti = _inst_type_info(_0);
@@ -167,13 +263,23 @@ __NEXT_STEP:;
     TARGET(STORE_FAST)
         frame->_locals[byte.arg] = POPX();
         DISPATCH();
+    TARGET(STORE_DEREF)
+        _1 = frame->_locals[byte.arg];
+        PK_OBJ_GET(Cell, _1).value = POPX();
+        heap.write_barrier(_1);
+        DISPATCH();
     TARGET(STORE_NAME){
         _name = StrName(byte.arg);
         _0 = POPX();
         if(frame->_callable != nullptr){
             PyObject** slot = frame->_locals.try_get_name(_name);
             if(slot == nullptr) vm->UnboundLocalError(_name);
-            *slot = _0;
+            if(is_non_tagged_type(*slot, tp_cell)){
+                PK_OBJ_GET(Cell, *slot).value = _0;
+                heap.write_barrier(*slot);
+            }else{
+                *slot = _0;
+            }
         }else{
             frame->f_globals().set(_name, _0);
         }
@@ -184,10 +290,11 @@ __NEXT_STEP:;
     TARGET(STORE_ATTR) {
         _0 = TOP();         // a
         _1 = SECOND();      // val
-        setattr(_0, StrName(byte.arg), _1);
+        _setattr_cached(co->attr_caches[frame->_ip], _0, StrName(byte.arg), _1);
         STACK_SHRINK(2);
     } DISPATCH();
     TARGET(STORE_SUBSCR)
+        if(is_small_int(TOP()) && is_non_tagged_type(SECOND(), tp_list)) QUICKEN(STORE_SUBSCR_LIST_INT);
         _2 = POPX();        // b
         _1 = POPX();        // a
         _0 = POPX();        // val
@@ -203,11 +310,17 @@ __NEXT_STEP:;
         if(_0 == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg]);
         frame->_locals[byte.arg] = PY_NULL;
         DISPATCH();
+    TARGET(DELETE_DEREF) {
+        Cell& cell = PK_OBJ_GET(Cell, frame->_locals[byte.arg]);
+        if(cell.value == PY_NULL) vm->UnboundLocalError(co->varnames[byte.arg]);
+        cell.value = PY_NULL;
+    } DISPATCH();
     TARGET(DELETE_NAME)
         _name = StrName(byte.arg);
         if(frame->_callable != nullptr){
             PyObject** slot = frame->_locals.try_get_name(_name);
             if(slot == nullptr) vm->UnboundLocalError(_name);
+            if(is_non_tagged_type(*slot, tp_cell)) slot = &PK_OBJ_GET(Cell, *slot).value;
             *slot = PY_NULL;
         }else{
             if(!frame->f_globals().contains(_name)) vm->NameError(_name);
@@ -228,6 +341,7 @@ __NEXT_STEP:;
         if(is_tagged(_0) || !_0->is_attr_valid()) TypeError("cannot delete attribute");
         if(!_0->attr().contains(_name)) AttributeError(_0, _name);
         _0->attr().erase(_name);
+        if(is_non_tagged_type(_0, tp_type)) _type_modified(PK_OBJ_GET(Type, _0));
         DISPATCH();
     TARGET(DELETE_SUBSCR)
         _1 = POPX();
@@ -241,10 +355,10 @@ __NEXT_STEP:;
         DISPATCH();
     /*****************************************/
     TARGET(BUILD_LONG) {
-        PK_LOCAL_STATIC const StrName m_long("long");
-        _0 = builtins->attr().try_get(m_long);
-        if(_0 == nullptr) AttributeError(builtins, m_long);
-        TOP() = call(_0, TOP());
+        const Str& s = CAST(Str&, TOP());
+        BigInt value;
+        if(!BigInt::from_str(s.sv(), value)) ValueError("invalid literal for long(): " + s.escape());
+        TOP() = VAR(std::move(value));
     } DISPATCH();
     TARGET(BUILD_BYTES) {
         const Str& s = CAST(Str&, TOP());
@@ -272,12 +386,14 @@ __NEXT_STEP:;
         STACK_SHRINK(byte.arg);
         PUSH(_0);
         DISPATCH();
-    TARGET(BUILD_SET)
-        _0 = VAR(STACK_VIEW(byte.arg).to_list());
-        _0 = call(builtins->attr(pk_id_set), _0);
+    TARGET(BUILD_SET) {
+        // the items stay on the stack while hashing them may run python code
+        Set set(this);
+        for(PyObject* obj: STACK_VIEW(byte.arg)) set.add(obj);
+        _0 = VAR(std::move(set));
         STACK_SHRINK(byte.arg);
         PUSH(_0);
-        DISPATCH();
+    } DISPATCH();
     TARGET(BUILD_SLICE)
         _2 = POPX();    // step
         _1 = POPX();    // stop
@@ -321,8 +437,9 @@ __NEXT_STEP:;
         List list;
         _unpack_as_list(STACK_VIEW(byte.arg), list);
         STACK_SHRINK(byte.arg);
-        _0 = VAR(std::move(list));
-        _0 = call(builtins->attr(pk_id_set), _0);
+        Set set(this);
+        for(PyObject* obj: list) set.add(obj);
+        _0 = VAR(std::move(set));
         PUSH(_0);
     } DISPATCH();
     /*****************************************/
@@ -337,18 +454,28 @@ __NEXT_STEP:;
         DISPATCH();                                     \
     }
 
+#define QUICKEN_COMPARE_OP(op)                                          \
+        if(is_small_int(TOP()) && is_small_int(SECOND())){              \
+            QUICKEN(COMPARE_##op##_INT);                                \
+        }else if(_is_float_pair(SECOND(), TOP())){                      \
+            QUICKEN(COMPARE_##op##_FLOAT);                              \
+        }
+
+// operands stay on the stack until the call returns, in case of gc
 #define BINARY_OP_SPECIAL(func)                         \
-        _1 = POPX();                                    \
-        _0 = TOP();                                     \
+        _1 = TOP();                                     \
+        _0 = SECOND();                                  \
         _ti = _inst_type_info(_0);                      \
         if(_ti->m##func){                               \
-            TOP() = _ti->m##func(this, _0, _1);         \
+            _2 = _ti->m##func(this, _0, _1);            \
         }else{                                          \
             PyObject* self;                                         \
             _2 = get_unbound_method(_0, func, &self, false);        \
-            if(_2 != nullptr) TOP() = call_method(self, _2, _1);    \
-            else TOP() = NotImplemented;                            \
-        }
+            if(_2 != nullptr) _2 = call_method(self, _2, _1);       \
+            else _2 = NotImplemented;                               \
+        }                                                           \
+        POP();                                                      \
+        TOP() = _2;
 
 #define BINARY_OP_RSPECIAL(op, func)                                \
         if(TOP() == NotImplemented){                                \
@@ -360,6 +487,7 @@ __NEXT_STEP:;
         }
 
     TARGET(BINARY_TRUEDIV)
+        if(_is_number(TOP()) && _is_number(SECOND())) QUICKEN(BINARY_TRUEDIV_FLOAT);
         BINARY_OP_SPECIAL(__truediv__);
         if(TOP() == NotImplemented) BinaryOptError("/");
         DISPATCH();
@@ -369,15 +497,21 @@ __NEXT_STEP:;
         DISPATCH();
     TARGET(BINARY_ADD)
         PREDICT_INT_OP(+);
-        BINARY_OP_SPECIAL(__add__);
-        BINARY_OP_RSPECIAL("+", __radd__);
+        if(_is_float_pair(SECOND(), TOP())) QUICKEN(BINARY_ADD_FLOAT);
+        else if(is_non_tagged_type(SECOND(), tp_str) && is_non_tagged_type(TOP(), tp_str)) QUICKEN(BINARY_ADD_STR);
+        // shared with `sum()`, the operands stay on the stack during the call
+        _0 = py_add(SECOND(), TOP());
+        POP();
+        TOP() = _0;
         DISPATCH()
     TARGET(BINARY_SUB)
         PREDICT_INT_OP(-);
+        if(_is_float_pair(SECOND(), TOP())) QUICKEN(BINARY_SUB_FLOAT);
         BINARY_OP_SPECIAL(__sub__);
         BINARY_OP_RSPECIAL("-", __rsub__);
         DISPATCH()
     TARGET(BINARY_MUL)
+        if(_is_float_pair(SECOND(), TOP())) QUICKEN(BINARY_MUL_FLOAT);
         BINARY_OP_SPECIAL(__mul__);
         BINARY_OP_RSPECIAL("*", __rmul__);
         DISPATCH()
@@ -392,38 +526,43 @@ __NEXT_STEP:;
         if(TOP() == NotImplemented) BinaryOptError("%");
         DISPATCH()
     TARGET(COMPARE_LT)
+        QUICKEN_COMPARE_OP(LT);
         BINARY_OP_SPECIAL(__lt__);
         BINARY_OP_RSPECIAL("<", __gt__);
         DISPATCH()
     TARGET(COMPARE_LE)
+        QUICKEN_COMPARE_OP(LE);
         BINARY_OP_SPECIAL(__le__);
         BINARY_OP_RSPECIAL("<=", __ge__);
         DISPATCH()
     TARGET(COMPARE_EQ)
-        _1 = POPX();
-        _0 = TOP();
-        TOP() = VAR(py_equals(_0, _1));
+        _0 = VAR(py_equals(SECOND(), TOP()));
+        POP();
+        TOP() = _0;
         DISPATCH()
     TARGET(COMPARE_NE)
-        _1 = POPX();
-        _0 = TOP();
-        TOP() = VAR(!py_equals(_0, _1));
+        _0 = VAR(!py_equals(SECOND(), TOP()));
+        POP();
+        TOP() = _0;
         DISPATCH()
     TARGET(COMPARE_GT)
+        QUICKEN_COMPARE_OP(GT);
         BINARY_OP_SPECIAL(__gt__);
         BINARY_OP_RSPECIAL(">", __lt__);
         DISPATCH()
     TARGET(COMPARE_GE)
+        QUICKEN_COMPARE_OP(GE);
         BINARY_OP_SPECIAL(__ge__);
         BINARY_OP_RSPECIAL(">=", __le__);
         DISPATCH()
     TARGET(BITWISE_LSHIFT)
-        PREDICT_INT_OP(<<);
+        // a small int shifted by less than 32 bits always fits in i64
+        if(is_small_int(TOP()) && _py_sint(TOP()) >= 0 && _py_sint(TOP()) < 32) PREDICT_INT_OP(<<);
         BINARY_OP_SPECIAL(__lshift__);
         if(TOP() == NotImplemented) BinaryOptError("<<");
         DISPATCH()
     TARGET(BITWISE_RSHIFT)
-        PREDICT_INT_OP(>>);
+        if(is_small_int(TOP()) && _py_sint(TOP()) >= 0 && _py_sint(TOP()) < 64) PREDICT_INT_OP(>>);
         BINARY_OP_SPECIAL(__rshift__);
         if(TOP() == NotImplemented) BinaryOptError(">>");
         DISPATCH()
@@ -447,8 +586,43 @@ __NEXT_STEP:;
         if(TOP() == NotImplemented) BinaryOptError("@");
         DISPATCH();
 
+#define COMPARE_JUMP_OP(op, func, rfunc)                                \
+        if(is_small_int(TOP()) && is_small_int(SECOND())){              \
+            _1 = POPX();                                                \
+            _0 = POPX();                                                \
+            if(!(_py_sint(_0) op _py_sint(_1))) frame->jump_abs(byte.arg);      \
+            DISPATCH();                                                 \
+        }                                                               \
+        if(_is_float_pair(SECOND(), TOP())){                            \
+            _1 = POPX();                                                \
+            _0 = POPX();                                                \
+            if(!(_py_number(_0) op _py_number(_1))) frame->jump_abs(byte.arg);  \
+            DISPATCH();                                                 \
+        }                                                               \
+        BINARY_OP_SPECIAL(func);                                        \
+        BINARY_OP_RSPECIAL(#op, rfunc);                                 \
+        if(!py_bool(POPX())) frame->jump_abs(byte.arg);                 \
+        DISPATCH();
+
+    TARGET(COMPARE_LT_JUMP_IF_FALSE) COMPARE_JUMP_OP(<, __lt__, __gt__)
+    TARGET(COMPARE_LE_JUMP_IF_FALSE) COMPARE_JUMP_OP(<=, __le__, __ge__)
+    TARGET(COMPARE_GT_JUMP_IF_FALSE) COMPARE_JUMP_OP(>, __gt__, __lt__)
+    TARGET(COMPARE_GE_JUMP_IF_FALSE) COMPARE_JUMP_OP(>=, __ge__, __le__)
+    TARGET(COMPARE_EQ_JUMP_IF_FALSE){
+        bool ok = py_equals(SECOND(), TOP());
+        STACK_SHRINK(2);
+        if(!ok) frame->jump_abs(byte.arg);
+    } DISPATCH();
+    TARGET(COMPARE_NE_JUMP_IF_FALSE){
+        bool ok = py_equals(SECOND(), TOP());
+        STACK_SHRINK(2);
+        if(ok) frame->jump_abs(byte.arg);
+    } DISPATCH();
+
+#undef COMPARE_JUMP_OP
 #undef BINARY_OP_SPECIAL
 #undef PREDICT_INT_OP
+#undef QUICKEN_COMPARE_OP
 
     TARGET(IS_OP)
         _1 = POPX();    // rhs
@@ -473,6 +647,9 @@ __NEXT_STEP:;
     TARGET(POP_JUMP_IF_FALSE)
         if(!py_bool(POPX())) frame->jump_abs(byte.arg);
         DISPATCH();
+    TARGET(POP_JUMP_IF_TRUE)
+        if(py_bool(POPX())) frame->jump_abs(byte.arg);
+        DISPATCH();
     TARGET(JUMP_IF_TRUE_OR_POP)
         if(py_bool(TOP()) == true) frame->jump_abs(byte.arg);
         else POP();
@@ -547,6 +724,14 @@ __NEXT_STEP:;
         DISPATCH();
     TARGET(RETURN_VALUE)
         _0 = POPX();
+        if(co->is_generator && frame.index != base_id){
+            // a generator resumed by `FOR_ITER` is exhausted, run `FOR_ITER` again to exit the loop
+            PK_OBJ_GET(Generator, frame->_sp_base[-1]).state = 2;
+            _pop_frame();
+            frame = top_frame();
+            frame->_next_ip = frame->_ip;
+            goto __NEXT_FRAME;
+        }
         _pop_frame();
         if(frame.index == base_id){       // [ frameBase<- ]
             return _0;
@@ -556,11 +741,20 @@ __NEXT_STEP:;
             goto __NEXT_FRAME;
         }
     TARGET(YIELD_VALUE)
-        return PY_OP_YIELD;
+        if(frame.index == base_id) return PY_OP_YIELD;
+        // resumed by `FOR_ITER`, the generator is on the top of the caller's stack
+        _0 = frame->_sp_base[-1];
+        _1 = PK_OBJ_GET(Generator, _0)._suspend(this);
+        heap.write_barrier(_0);
+        frame = top_frame();
+        if(_1 != StopIteration) PUSH(_1);
+        else frame->_next_ip = frame->_ip;
+        goto __NEXT_FRAME;
     /*****************************************/
     TARGET(LIST_APPEND)
         _0 = POPX();
         CAST(List&, SECOND()).push_back(_0);
+        heap.write_barrier(SECOND());
         DISPATCH();
     TARGET(DICT_ADD) {
         _0 = POPX();
@@ -568,8 +762,10 @@ __NEXT_STEP:;
         call_method(SECOND(), __setitem__, t[0], t[1]);
     } DISPATCH();
     TARGET(SET_ADD)
-        _0 = POPX();
-        call_method(SECOND(), pk_id_add, _0);
+        // keep the item on the stack until it is stored
+        CAST(Set&, THIRD()).add(TOP());
+        heap.write_barrier(THIRD());
+        POP();
         DISPATCH();
     /*****************************************/
     TARGET(UNARY_NEGATIVE)
@@ -589,9 +785,27 @@ __NEXT_STEP:;
         DISPATCH();
     /*****************************************/
     TARGET(GET_ITER)
-        TOP() = py_iter(TOP());
+        _0 = TOP();
+        TOP() = py_iter(_0);
+        // the next instruction is always FOR_ITER
+        if(is_non_tagged_type(_0, tp_range)){
+            _quicken(co, frame->_ip+1, OP_FOR_ITER_RANGE, _tp(TOP()));
+        }else if(is_non_tagged_type(_0, tp_list) || is_non_tagged_type(_0, tp_tuple)){
+            _quicken(co, frame->_ip+1, OP_FOR_ITER_LIST, _tp(TOP()));
+        }
         DISPATCH();
     TARGET(FOR_ITER)
+        if(is_non_tagged_type(TOP(), tp_generator)){
+            // switch to the frame of the generator in place, `YIELD_VALUE` switches back
+            Generator& gen = PK_OBJ_GET(Generator, TOP());
+            if(gen.state != 2){
+                gen._resume(this);
+                frame = top_frame();
+                goto __NEXT_FRAME;
+            }
+            frame->jump_abs_break(co_blocks[byte.block].end);
+            DISPATCH();
+        }
         _0 = py_next(TOP());
         if(_0 != StopIteration){
             PUSH(_0);
@@ -671,8 +885,10 @@ __NEXT_STEP:;
         _0 = POPX();
         if(is_non_tagged_type(_0, tp_function)){
             _0->attr().set(__class__, TOP());
+            heap.write_barrier(_0);
         }
         TOP()->attr().set(_name, _0);
+        _type_modified(PK_OBJ_GET(Type, TOP()));
     } DISPATCH();
     /*****************************************/
     TARGET(WITH_ENTER)
@@ -693,7 +909,10 @@ __NEXT_STEP:;
         }
         bool ok = py_bool(_0);
         POP();
-        if(!ok) _error("AssertionError", msg);
+        if(!ok){
+            PUSH(VAR(Exception("AssertionError", msg)));
+            goto __RAISE;
+        }
     } DISPATCH();
     TARGET(EXCEPTION_MATCH) {
         const auto& e = CAST(Exception&, TOP());
@@ -703,9 +922,10 @@ __NEXT_STEP:;
     TARGET(RAISE) {
         _0 = POPX();
         Str msg = _0 == None ? "" : CAST(Str, py_str(_0));
-        _error(StrName(byte.arg), msg);
-    } DISPATCH();
-    TARGET(RE_RAISE) _raise(true); DISPATCH();
+        PUSH(VAR(Exception(StrName(byte.arg), msg)));
+        goto __RAISE;
+    }
+    TARGET(RE_RAISE) goto __RE_RAISE;
     TARGET(POP_EXCEPTION) _last_exception = POPX(); DISPATCH();
     /*****************************************/
     TARGET(FORMAT_STRING) {
@@ -715,14 +935,19 @@ __NEXT_STEP:;
     } DISPATCH();
     /*****************************************/
     TARGET(INC_FAST){
-        PyObject** p = &frame->_locals[byte.arg];
+        _1 = frame->_locals[byte.arg];
+        // the variable may be captured by a nested function
+        PyObject** p = is_non_tagged_type(_1, tp_cell) ? &PK_OBJ_GET(Cell, _1).value : &frame->_locals[byte.arg];
         if(*p == PY_NULL) vm->NameError(co->varnames[byte.arg]);
         *p = VAR(CAST(i64, *p) + 1);
+        if(p != &frame->_locals[byte.arg]) heap.write_barrier(_1);
     } DISPATCH();
     TARGET(DEC_FAST){
-        PyObject** p = &frame->_locals[byte.arg];
+        _1 = frame->_locals[byte.arg];
+        PyObject** p = is_non_tagged_type(_1, tp_cell) ? &PK_OBJ_GET(Cell, _1).value : &frame->_locals[byte.arg];
         if(*p == PY_NULL) vm->NameError(co->varnames[byte.arg]);
         *p = VAR(CAST(i64, *p) - 1);
+        if(p != &frame->_locals[byte.arg]) heap.write_barrier(_1);
     } DISPATCH();
     TARGET(INC_GLOBAL){
         _name = StrName(byte.arg);
@@ -736,6 +961,78 @@ __NEXT_STEP:;
         if(p == nullptr) vm->NameError(_name);
         *p = VAR(CAST(i64, *p) - 1);
     } DISPATCH();
+    /*****************************************/
+#define BINARY_FLOAT_OP(generic, op)                                    \
+        if(!_is_float_pair(SECOND(), TOP())) DEOPTIMIZE(generic);       \
+        _1 = POPX();                                                    \
+        TOP() = VAR(_py_number(TOP()) op _py_number(_1));               \
+        DISPATCH();
+
+#define COMPARE_INT_OP(generic, op)                                     \
+        if(!is_small_int(TOP()) || !is_small_int(SECOND())) DEOPTIMIZE(generic);   \
+        _1 = POPX();                                                    \
+        TOP() = VAR(_py_sint(TOP()) op _py_sint(_1));                   \
+        DISPATCH();
+
+    TARGET(BINARY_ADD_FLOAT) BINARY_FLOAT_OP(BINARY_ADD, +)
+    TARGET(BINARY_SUB_FLOAT) BINARY_FLOAT_OP(BINARY_SUB, -)
+    TARGET(BINARY_MUL_FLOAT) BINARY_FLOAT_OP(BINARY_MUL, *)
+    TARGET(BINARY_TRUEDIV_FLOAT)
+        if(!_is_number(TOP()) || !_is_number(SECOND())) DEOPTIMIZE(BINARY_TRUEDIV);
+        _1 = POPX();
+        TOP() = VAR(_py_number(TOP()) / _py_number(_1));
+        DISPATCH();
+    TARGET(BINARY_ADD_STR)
+        if(!is_non_tagged_type(TOP(), tp_str) || !is_non_tagged_type(SECOND(), tp_str)) DEOPTIMIZE(BINARY_ADD);
+        _1 = POPX();
+        TOP() = VAR(_CAST(Str&, TOP()) + _CAST(Str&, _1));
+        DISPATCH();
+    TARGET(COMPARE_LT_INT) COMPARE_INT_OP(COMPARE_LT, <)
+    TARGET(COMPARE_LE_INT) COMPARE_INT_OP(COMPARE_LE, <=)
+    TARGET(COMPARE_GT_INT) COMPARE_INT_OP(COMPARE_GT, >)
+    TARGET(COMPARE_GE_INT) COMPARE_INT_OP(COMPARE_GE, >=)
+    TARGET(COMPARE_LT_FLOAT) BINARY_FLOAT_OP(COMPARE_LT, <)
+    TARGET(COMPARE_LE_FLOAT) BINARY_FLOAT_OP(COMPARE_LE, <=)
+    TARGET(COMPARE_GT_FLOAT) BINARY_FLOAT_OP(COMPARE_GT, >)
+    TARGET(COMPARE_GE_FLOAT) BINARY_FLOAT_OP(COMPARE_GE, >=)
+
+#undef BINARY_FLOAT_OP
+#undef COMPARE_INT_OP
+
+    TARGET(LOAD_SUBSCR_LIST_INT){
+        if(!is_small_int(TOP()) || !is_non_tagged_type(SECOND(), tp_list)) DEOPTIMIZE(LOAD_SUBSCR);
+        _1 = POPX();
+        List& list = _CAST(List&, TOP());
+        TOP() = list[normalized_index(_py_sint(_1), list.size())];
+    } DISPATCH();
+    TARGET(STORE_SUBSCR_LIST_INT){
+        if(!is_small_int(TOP()) || !is_non_tagged_type(SECOND(), tp_list)) DEOPTIMIZE(STORE_SUBSCR);
+        _2 = POPX();        // b
+        _1 = POPX();        // a
+        _0 = POPX();        // val
+        List& list = _CAST(List&, _1);
+        list[normalized_index(_py_sint(_2), list.size())] = _0;
+        heap.write_barrier(_1);
+    } DISPATCH();
+    TARGET(FOR_ITER_RANGE){
+        if(_tp(TOP()).index != byte.arg) DEOPTIMIZE(FOR_ITER);
+        RangeIter& it = _CAST(RangeIter&, TOP());
+        if(it.r.step > 0 ? it.current < it.r.stop : it.current > it.r.stop){
+            PUSH(VAR(it.current));
+            it.current += it.r.step;
+        }else{
+            frame->jump_abs_break(co_blocks[byte.block].end);
+        }
+    } DISPATCH();
+    TARGET(FOR_ITER_LIST){
+        if(_tp(TOP()).index != byte.arg) DEOPTIMIZE(FOR_ITER);
+        ArrayIter& it = _CAST(ArrayIter&, TOP());
+        if(it.current != it.end){
+            PUSH(*it.current++);
+        }else{
+            frame->jump_abs_break(co_blocks[byte.block].end);
+        }
+    } DISPATCH();
 
 #if !PK_ENABLE_COMPUTED_GOTO
 #if PK_DEBUG_EXTRA_CHECK
@@ -751,6 +1048,8 @@ __NEXT_STEP:;
 #undef TARGET
 #undef DISPATCH_OP_CALL
 #undef CEVAL_STEP
+#undef QUICKEN
+#undef DEOPTIMIZE
 /**********************************************************************/
             UNREACHABLE();
         }catch(HandledException& e){
@@ -758,30 +1057,14 @@ __NEXT_STEP:;
             continue;
         }catch(UnhandledException& e){
             PK_UNUSED(e);
-            PyObject* obj = POPX();
-            Exception& _e = CAST(Exception&, obj);
-            int actual_ip = frame->_ip;
-            if(_e._ip_on_error >= 0 && _e._code_on_error == (void*)frame->co) actual_ip = _e._ip_on_error;
-            int current_line = frame->co->lines[actual_ip];         // current line
-            auto current_f_name = frame->co->name.sv();             // current function name
-            if(frame->_callable == nullptr) current_f_name = "";    // not in a function
-            _e.st_push(frame->co->src->snapshot(current_line, nullptr, current_f_name));
-            _pop_frame();
-            if(callstack.empty()){
-#if PK_DEBUG_FULL_EXCEPTION
-                std::cerr << _e.summary() << std::endl;
-#endif
-                throw _e;
-            }
-            frame = top_frame();
-            PUSH(obj);
-            if(frame.index < base_id) throw ToBeRaisedException();
-            need_raise = true;
+            need_unwind = true;
         }catch(ToBeRaisedException& e){
             PK_UNUSED(e);
             need_raise = true;
         }
     }
+    // the exception is not handled by the frames of this call, let the caller raise it
+    throw ToBeRaisedException();
 }
 
 #undef TOP
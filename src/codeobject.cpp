@@ -5,11 +5,178 @@ namespace pkpy{
     CodeObject::CodeObject(std::shared_ptr<SourceData> src, const Str& name):
         src(src), name(name) {}
 
+    static bool is_jump_op(uint16_t op){
+        switch(op){
+            case OP_JUMP_ABSOLUTE: case OP_POP_JUMP_IF_FALSE: case OP_POP_JUMP_IF_TRUE:
+            case OP_JUMP_IF_TRUE_OR_POP: case OP_JUMP_IF_FALSE_OR_POP: case OP_SHORTCUT_IF_FALSE_OR_POP:
+            case OP_COMPARE_LT_JUMP_IF_FALSE: case OP_COMPARE_LE_JUMP_IF_FALSE:
+            case OP_COMPARE_GT_JUMP_IF_FALSE: case OP_COMPARE_GE_JUMP_IF_FALSE:
+            case OP_COMPARE_EQ_JUMP_IF_FALSE: case OP_COMPARE_NE_JUMP_IF_FALSE:
+                return true;
+            default: return false;
+        }
+    }
+
+    // the next instruction is not executed after these
+    static bool is_terminal_op(uint16_t op){
+        switch(op){
+            case OP_JUMP_ABSOLUTE: case OP_RETURN_VALUE: case OP_LOOP_CONTINUE: case OP_LOOP_BREAK:
+            case OP_GOTO: case OP_RAISE: case OP_RE_RAISE:
+                return true;
+            default: return false;
+        }
+    }
+
+    // `COMPARE_XX POP_JUMP_IF_FALSE` -> `COMPARE_XX_JUMP_IF_FALSE`
+    static int compare_jump_op(uint16_t op){
+        switch(op){
+            case OP_COMPARE_LT: return OP_COMPARE_LT_JUMP_IF_FALSE;
+            case OP_COMPARE_LE: return OP_COMPARE_LE_JUMP_IF_FALSE;
+            case OP_COMPARE_GT: return OP_COMPARE_GT_JUMP_IF_FALSE;
+            case OP_COMPARE_GE: return OP_COMPARE_GE_JUMP_IF_FALSE;
+            case OP_COMPARE_EQ: return OP_COMPARE_EQ_JUMP_IF_FALSE;
+            case OP_COMPARE_NE: return OP_COMPARE_NE_JUMP_IF_FALSE;
+            default: return -1;
+        }
+    }
+
+    // peephole optimizer, runs after all bytecodes are emitted
+    void CodeObject::optimize(){
+        const int n = codes.size();
+        num_unoptimized_codes = n;
+
+        // block boundaries and labels cannot be moved or removed
+        std::vector<bool> pinned(n+1, false);
+        for(int i=1; i<(int)blocks.size(); i++){
+            pinned[blocks[i].start] = true;
+            if(blocks[i].end >= 0) pinned[blocks[i].end] = true;
+            if(blocks[i].end2 >= 0) pinned[blocks[i].end2] = true;
+        }
+        labels.apply([&](StrName name, int target){ pinned[target] = true; });
+
+        // thread jump chains
+        for(Bytecode& byte: codes){
+            if(!is_jump_op(byte.op)) continue;
+            int target = byte.arg;
+            for(int k=0; k<n && target<n && codes[target].op==OP_JUMP_ABSOLUTE; k++){
+                target = codes[target].arg;
+            }
+            byte.arg = target;
+        }
+
+        std::vector<bool> is_target = pinned;
+        for(Bytecode byte: codes){
+            if(is_jump_op(byte.op)) is_target[byte.arg] = true;
+        }
+
+        // fuse instruction pairs, picked from `run_opcode_pairs.sh`
+        for(int i=0; i+1<n; i++){
+            Bytecode& a = codes[i];
+            Bytecode& b = codes[i+1];
+            if(a.op == OP_JUMP_ABSOLUTE && a.arg == i+1){
+                a.op = OP_NO_OP;
+                a.arg = BC_NOARG;
+                continue;
+            }
+            // keep the original pairs visible to the profiler
+            if(PK_DEBUG_OPCODE_PAIRS || is_target[i+1]) continue;
+            if(a.op == OP_UNARY_NOT && b.op == OP_POP_JUMP_IF_FALSE){
+                a.op = OP_POP_JUMP_IF_TRUE;
+                a.arg = b.arg;
+            }else if(a.op == OP_LOAD_FAST && b.op == OP_LOAD_FAST && lines[i] == lines[i+1]){
+                a.op = OP_LOAD_FAST_LOAD_FAST;
+                a.arg = (a.arg << 16) | b.arg;
+            }else if(a.op == OP_LOAD_FAST && b.op == OP_LOAD_INTEGER && b.arg >= INT16_MIN && b.arg <= INT16_MAX){
+                a.op = OP_LOAD_FAST_LOAD_INTEGER;
+                a.arg = (a.arg << 16) | (uint16_t)b.arg;
+            }else if(a.op == OP_LOAD_FAST && b.op == OP_LOAD_ATTR && b.arg <= 0xFFFF){
+                a.op = OP_LOAD_FAST_LOAD_ATTR;
+                a.arg = (a.arg << 16) | b.arg;
+            }else if(compare_jump_op(a.op) >= 0 && b.op == OP_POP_JUMP_IF_FALSE){
+                a.op = compare_jump_op(a.op);
+                a.arg = b.arg;
+            }else{
+                continue;
+            }
+            b.op = OP_NO_OP;
+            b.arg = BC_NOARG;
+            i++;
+        }
+
+        // find reachable instructions
+        std::vector<bool> reachable(n, false);
+        std::vector<int> pending = {0};
+        for(int i=0; i<n; i++) if(pinned[i]) pending.push_back(i);
+        while(!pending.empty()){
+            int i = pending.back();
+            pending.pop_back();
+            if(i >= n || reachable[i]) continue;
+            reachable[i] = true;
+            if(is_jump_op(codes[i].op)) pending.push_back(codes[i].arg);
+            if(!is_terminal_op(codes[i].op)) pending.push_back(i+1);
+        }
+
+        // remove dead code and no-ops
+        std::vector<int> new_index(n+1);
+        std::vector<Bytecode> new_codes;
+        std::vector<int> new_lines;
+        for(int i=0; i<n; i++){
+            new_index[i] = new_codes.size();
+            if(!reachable[i]) continue;
+            if(codes[i].op == OP_NO_OP && !pinned[i]) continue;
+            new_codes.push_back(codes[i]);
+            new_lines.push_back(lines[i]);
+        }
+        new_index[n] = new_codes.size();
+        if((int)new_codes.size() == n) return;
+
+        for(Bytecode& byte: new_codes){
+            if(is_jump_op(byte.op)) byte.arg = new_index[byte.arg];
+        }
+        for(CodeBlock& block: blocks){
+            block.start = new_index[block.start];
+            if(block.end >= 0) block.end = new_index[block.end];
+            if(block.end2 >= 0) block.end2 = new_index[block.end2];
+        }
+        for(auto [name, target]: labels.items()) labels.set(name, new_index[target]);
+        codes = std::move(new_codes);
+        lines = std::move(new_lines);
+    }
+
     void CodeObject::_gc_mark() const {
         for(PyObject* v : consts) PK_OBJ_MARK(v);
         for(auto& decl: func_decls) decl->_gc_mark();
     }
 
+    void FuncDecl::_init_is_simple(){
+        is_simple = kwargs.empty() && starred_arg == -1 && starred_kwarg == -1;
+        for(int i=0; i<args.size(); i++) if(args[i] != i) is_simple = false;
+    }
+
+    Bytecode Bytecode::generic() const{
+        switch(op){
+            case OP_BINARY_ADD_FLOAT: case OP_BINARY_ADD_STR:
+                return {OP_BINARY_ADD, block, arg};
+            case OP_BINARY_SUB_FLOAT: return {OP_BINARY_SUB, block, arg};
+            case OP_BINARY_MUL_FLOAT: return {OP_BINARY_MUL, block, arg};
+            case OP_BINARY_TRUEDIV_FLOAT: return {OP_BINARY_TRUEDIV, block, arg};
+            case OP_COMPARE_LT_INT: case OP_COMPARE_LT_FLOAT:
+                return {OP_COMPARE_LT, block, arg};
+            case OP_COMPARE_LE_INT: case OP_COMPARE_LE_FLOAT:
+                return {OP_COMPARE_LE, block, arg};
+            case OP_COMPARE_GT_INT: case OP_COMPARE_GT_FLOAT:
+                return {OP_COMPARE_GT, block, arg};
+            case OP_COMPARE_GE_INT: case OP_COMPARE_GE_FLOAT:
+                return {OP_COMPARE_GE, block, arg};
+            case OP_LOAD_SUBSCR_LIST_INT: return {OP_LOAD_SUBSCR, block, arg};
+            case OP_STORE_SUBSCR_LIST_INT: return {OP_STORE_SUBSCR, block, arg};
+            // `arg` holds the iterator type
+            case OP_FOR_ITER_RANGE: case OP_FOR_ITER_LIST:
+                return {OP_FOR_ITER, block, BC_NOARG};
+            default: return *this;
+        }
+    }
+
     void CodeObject::write(VM* vm, CodeObjectSerializer& ss) const{
         ss.write_begin_mark();          // [
         ss.write_str(src->filename);    // src->filename
@@ -19,7 +186,9 @@ namespace pkpy{
         ss.write_bool(is_generator);    // is_generator
         ss.write_begin_mark();          // [
             for(Bytecode bc: codes){
-                if(StrName::is_valid(bc.arg)) ss.names.insert(StrName(bc.arg));
+                bc = bc.generic();
+                if(bc.op == OP_LOAD_FAST_LOAD_ATTR) ss.names.insert(StrName(bc.arg & 0xFFFF));
+                else if(StrName::is_valid(bc.arg)) ss.names.insert(StrName(bc.arg));
                 ss.write_bytes(bc);
             }
         ss.write_end_mark();            // ]
@@ -38,6 +207,17 @@ namespace pkpy{
                 ss.write_name(vn);        // name
             }
         ss.write_end_mark();            // ]
+        ss.write_begin_mark();          // [
+            for(int index: cellvars){
+                ss.write_int(index);        // index
+            }
+        ss.write_end_mark();            // ]
+        ss.write_begin_mark();          // [
+            for(FreeVar fv: freevars){
+                ss.write_int(fv.index);     // fv.index
+                ss.write_int(fv.source);    // fv.source
+            }
+        ss.write_end_mark();            // ]
         ss.write_begin_mark();          // [
             for(CodeBlock block: blocks){
                 ss.write_bytes(block);      // block
@@ -65,7 +245,6 @@ namespace pkpy{
 
                 ss.write_int(decl->starred_arg);
                 ss.write_int(decl->starred_kwarg);
-                ss.write_bool(decl->nested);
             }
         ss.write_end_mark();            // ]
     }
@@ -154,6 +333,258 @@ void CodeObjectSerializer::write_code(VM* vm, const CodeObject* co){
     buffer += END;
 }
 
+    void CodeObject::_alloc_attr_caches(){
+        for(Bytecode bc: codes){
+            if(bc.op == OP_LOAD_ATTR || bc.op == OP_LOAD_METHOD || bc.op == OP_STORE_ATTR || bc.op == OP_LOAD_FAST_LOAD_ATTR){
+                attr_caches.resize(codes.size());
+                break;
+            }
+        }
+    }
+
+    static bool is_name_op(uint16_t op){
+        switch(op){
+            case OP_LOAD_NAME: case OP_LOAD_GLOBAL: case OP_LOAD_ATTR: case OP_LOAD_METHOD:
+            case OP_STORE_NAME: case OP_STORE_GLOBAL: case OP_STORE_ATTR:
+            case OP_DELETE_NAME: case OP_DELETE_GLOBAL: case OP_DELETE_ATTR:
+            case OP_GOTO: case OP_BEGIN_CLASS: case OP_STORE_CLASS_ATTR:
+            case OP_EXCEPTION_MATCH: case OP_RAISE: case OP_INC_GLOBAL: case OP_DEC_GLOBAL:
+            case OP_LOAD_KWARG_NAME:
+                return true;
+            default: return false;
+        }
+    }
+
+    // FNV-1a
+    static uint64_t hash_bytes(std::string_view sv){
+        uint64_t h = 14695981039346656037ULL;
+        for(char c: sv){
+            h ^= (unsigned char)c;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    static const char kBytecodeMagic[4] = {'p', 'k', 'b', 'c'};
+
+    void CodeObjectWriter::write_str(std::string_view sv){
+        write<int>(sv.size());
+        buffer.append(sv.data(), sv.size());
+    }
+
+    void CodeObjectWriter::write_name(StrName name){
+        auto it = name_ids.find(name);
+        if(it == name_ids.end()){
+            it = name_ids.emplace(name, (int)names.size()).first;
+            names.push_back(name);
+        }
+        write<int>(it->second);
+    }
+
+    void CodeObjectWriter::write_code(const CodeObject* co){
+        write_str(co->name.sv());
+        write<bool>(co->is_generator);
+        write<int>(co->num_unoptimized_codes);
+        write<int>(co->codes.size());
+        for(Bytecode bc: co->codes){
+            bc = bc.generic();
+            write<uint16_t>(bc.op);
+            write<uint16_t>(bc.block);
+            if(is_name_op(bc.op)){
+                write_name(StrName(bc.arg));
+            }else if(bc.op == OP_LOAD_FAST_LOAD_ATTR){
+                write<int>(bc.arg >> 16);
+                write_name(StrName(bc.arg & 0xFFFF));
+            }else{
+                write<int>(bc.arg);
+            }
+        }
+        for(int line: co->lines) write<int>(line);
+        write<int>(co->consts.size());
+        for(PyObject* obj: co->consts) write_object(obj);
+        write<int>(co->varnames.size());
+        for(StrName name: co->varnames) write_name(name);
+        write<int>(co->cellvars.size());
+        for(int index: co->cellvars) write<int>(index);
+        write<int>(co->freevars.size());
+        for(FreeVar fv: co->freevars) write<FreeVar>(fv);
+        write<int>(co->blocks.size());
+        for(const CodeBlock& block: co->blocks){
+            write<int>(block.type);
+            write<int>(block.parent);
+            write<int>(block.for_loop_depth);
+            write<int>(block.start);
+            write<int>(block.end);
+            write<int>(block.end2);
+        }
+        write<int>(co->labels.size());
+        for(auto [name, target]: co->labels.items()){
+            write_name(name);
+            write<int>(target);
+        }
+        write<int>(co->func_decls.size());
+        for(const FuncDecl_& decl: co->func_decls){
+            write_code(decl->code.get());
+            write<int>(decl->args.size());
+            for(int arg: decl->args) write<int>(arg);
+            write<int>(decl->kwargs.size());
+            for(auto& kw: decl->kwargs){
+                write<int>(kw.key);
+                write_object(kw.value);
+            }
+            write<int>(decl->starred_arg);
+            write<int>(decl->starred_kwarg);
+            write_str(decl->signature.sv());
+            write_str(decl->docstring.sv());
+        }
+    }
+
+    Str CodeObjectReader::read_str(){
+        int size = read<int>();
+        if(size < 0 || end - p < size) throw std::runtime_error("truncated bytecode");
+        Str s(p, size);
+        p += size;
+        return s;
+    }
+
+    StrName CodeObjectReader::read_name(){
+        int id = read<int>();
+        if(id < 0 || id >= (int)names.size()) throw std::runtime_error("invalid name in bytecode");
+        return names[id];
+    }
+
+    CodeObject_ CodeObjectReader::read_code(){
+        CodeObject_ co = std::make_shared<CodeObject>(src, read_str());
+        co->is_generator = read<bool>();
+        co->num_unoptimized_codes = read<int>();
+        int n = read<int>();
+        co->codes.resize(n);
+        for(Bytecode& bc: co->codes){
+            bc.op = read<uint16_t>();
+            bc.block = read<uint16_t>();
+            if(bc.op >= sizeof(OP_NAMES)/sizeof(OP_NAMES[0])) throw std::runtime_error("invalid opcode in bytecode");
+            if(is_name_op(bc.op)){
+                bc.arg = read_name().index;
+            }else if(bc.op == OP_LOAD_FAST_LOAD_ATTR){
+                int a = read<int>();
+                StrName name = read_name();
+                // the name is packed into 16 bits, see `CodeObject::optimize`
+                if(name.index > 0xFFFF) throw std::runtime_error("name index out of range");
+                bc.arg = (a << 16) | name.index;
+            }else{
+                bc.arg = read<int>();
+            }
+        }
+        co->lines.resize(n);
+        for(int& line: co->lines) line = read<int>();
+        n = read<int>();
+        for(int i=0; i<n; i++) co->consts.push_back(read_object());
+        n = read<int>();
+        for(int i=0; i<n; i++){
+            StrName name = read_name();
+            co->varnames.push_back(name);
+            co->varnames_inv.set(name, i);
+        }
+        n = read<int>();
+        for(int i=0; i<n; i++){
+            int index = read<int>();
+            if(index < 0 || index >= (int)co->varnames.size()) throw std::runtime_error("invalid cell in bytecode");
+            co->cellvars.push_back(index);
+        }
+        n = read<int>();
+        for(int i=0; i<n; i++){
+            FreeVar fv = read<FreeVar>();
+            if(fv.index < 0 || fv.index >= (int)co->varnames.size()) throw std::runtime_error("invalid cell in bytecode");
+            co->freevars.push_back(fv);
+        }
+        n = read<int>();
+        co->blocks.clear();
+        for(int i=0; i<n; i++){
+            CodeBlockType type = (CodeBlockType)read<int>();
+            int parent = read<int>();
+            int for_loop_depth = read<int>();
+            CodeBlock block(type, parent, for_loop_depth, read<int>());
+            block.end = read<int>();
+            block.end2 = read<int>();
+            co->blocks.push_back(block);
+        }
+        n = read<int>();
+        for(int i=0; i<n; i++){
+            StrName name = read_name();
+            co->labels.set(name, read<int>());
+        }
+        n = read<int>();
+        for(int i=0; i<n; i++){
+            FuncDecl_ decl = std::make_shared<FuncDecl>();
+            decl->code = read_code();
+            for(FreeVar fv: decl->code->freevars){
+                if(fv.source < 0 || fv.source >= (int)co->varnames.size()) throw std::runtime_error("invalid cell in bytecode");
+            }
+            int m = read<int>();
+            for(int j=0; j<m; j++) decl->args.push_back(read<int>());
+            m = read<int>();
+            for(int j=0; j<m; j++){
+                FuncDecl::KwArg kw;
+                kw.key = read<int>();
+                kw.value = read_object();
+                decl->kwargs.push_back(kw);
+            }
+            decl->starred_arg = read<int>();
+            decl->starred_kwarg = read<int>();
+            decl->signature = read_str();
+            decl->docstring = read_str();
+            decl->_init_is_simple();
+            co->func_decls.push_back(decl);
+        }
+        co->_alloc_attr_caches();
+        return co;
+    }
+
+    /* layout:
+     * magic, PK_VERSION, number of opcodes, hash of the source,
+     * hash of the rest, names table, code objects
+     */
+    Bytes CodeObject::dump(VM* vm) const{
+        CodeObjectWriter body(vm);
+        body.write_code(this);
+        CodeObjectWriter ss(vm);
+        ss.write<int>(body.names.size());
+        for(StrName name: body.names) ss.write_str(name.sv());
+        ss.buffer += body.buffer;
+        CodeObjectWriter header(vm);
+        header.buffer.append(kBytecodeMagic, sizeof(kBytecodeMagic));
+        header.write_str(PK_VERSION);
+        header.write<int>(sizeof(OP_NAMES)/sizeof(OP_NAMES[0]));
+        header.write<uint64_t>(hash_bytes(src->source));
+        header.write<uint64_t>(hash_bytes(ss.buffer));
+        header.buffer += ss.buffer;
+        return Bytes(std::string_view(header.buffer));
+    }
+
+    CodeObject_ CodeObject::load(VM* vm, const Bytes& data, std::shared_ptr<SourceData> src){
+        const char* p = (const char*)data.data();
+        CodeObjectReader r(vm, p, p + data.size(), src);
+        try{
+            for(char c: kBytecodeMagic) if(r.read<char>() != c) return nullptr;
+            if(r.read_str() != PK_VERSION) return nullptr;
+            if(r.read<int>() != sizeof(OP_NAMES)/sizeof(OP_NAMES[0])) return nullptr;
+            if(r.read<uint64_t>() != hash_bytes(src->source)) return nullptr;
+            if(r.read<uint64_t>() != hash_bytes(std::string_view(r.p, r.end - r.p))) return nullptr;
+            int n = r.read<int>();
+            for(int i=0; i<n; i++) r.names.push_back(StrName(r.read_str()));
+            CodeObject_ co = r.read_code();
+            if(r.p != r.end) return nullptr;
+            // the lexer is skipped, so find the lines for error messages here
+            const std::string& source = src->source;
+            for(int i=0; i<(int)source.size(); i++){
+                if(source[i] == '\n') src->line_starts.push_back(source.c_str() + i + 1);
+            }
+            return co;
+        }catch(std::runtime_error&){
+            return nullptr;
+        }
+    }
+
     NativeFunc::NativeFunc(NativeFuncC f, int argc, bool method){
         this->f = f;
         this->argc = argc;
@@ -0,0 +1,607 @@
+#include "pocketpy/collections.h"
+
+namespace pkpy{
+
+// A ring buffer with a power-of-2 capacity,
+// so both ends and indexing are O(1) without moving any items
+struct Deque{
+    PY_CLASS(Deque, _collections, deque)
+
+    static constexpr int kMinCapacity = 8;
+
+    PyObject** _data;
+    int _capacity;
+    int _mask;
+    int _head;          // position of the first item in `_data`
+    int _size;
+    int maxlen;         // -1 if unbounded
+    uint32_t _state = 0;    // bumped on every push or pop, iterators check it
+
+    Deque(int maxlen=-1): _capacity(kMinCapacity), _mask(kMinCapacity-1), _head(0), _size(0), maxlen(maxlen){
+        _data = (PyObject**)pool64_alloc(_capacity * sizeof(PyObject*));
+    }
+
+    Deque(const Deque& other){
+        memcpy(this, &other, sizeof(Deque));
+        _data = (PyObject**)pool64_alloc(_capacity * sizeof(PyObject*));
+        memcpy(_data, other._data, _capacity * sizeof(PyObject*));
+    }
+
+    Deque(Deque&& other){
+        memcpy(this, &other, sizeof(Deque));
+        other._data = nullptr;
+    }
+
+    Deque& operator=(const Deque&) = delete;
+    Deque& operator=(Deque&&) = delete;
+
+    ~Deque(){
+        if(_data != nullptr) pool64_dealloc(_data);
+    }
+
+    int size() const { return _size; }
+    PyObject*& operator[](int i){ return _data[(_head + i) & _mask]; }
+    PyObject* operator[](int i) const { return _data[(_head + i) & _mask]; }
+
+    void _resize(int capacity){
+        PyObject** data = (PyObject**)pool64_alloc(capacity * sizeof(PyObject*));
+        for(int i=0; i<_size; i++) data[i] = (*this)[i];
+        pool64_dealloc(_data);
+        _data = data;
+        _capacity = capacity;
+        _mask = capacity - 1;
+        _head = 0;
+    }
+
+    // shrink when mostly empty, the gap to the growth point keeps it amortized O(1)
+    void _try_shrink(){
+        if(_capacity > kMinCapacity && _size * 4 <= _capacity) _resize(_capacity / 2);
+    }
+
+    void push_back(PyObject* obj){
+        if(_size == maxlen){
+            if(maxlen == 0) return;
+            pop_front();
+        }
+        if(_size == _capacity) _resize(_capacity * 2);
+        (*this)[_size++] = obj;
+        _state++;
+    }
+
+    void push_front(PyObject* obj){
+        if(_size == maxlen){
+            if(maxlen == 0) return;
+            pop_back();
+        }
+        if(_size == _capacity) _resize(_capacity * 2);
+        _head = (_head - 1) & _mask;
+        _data[_head] = obj;
+        _size++;
+        _state++;
+    }
+
+    PyObject* pop_back(){
+        PyObject* obj = (*this)[--_size];
+        _state++;
+        _try_shrink();
+        return obj;
+    }
+
+    PyObject* pop_front(){
+        PyObject* obj = _data[_head];
+        _head = (_head + 1) & _mask;
+        _size--;
+        _state++;
+        _try_shrink();
+        return obj;
+    }
+
+    // shifts whichever side of `i` is shorter
+    void insert(int i, PyObject* obj){
+        if(_size == _capacity) _resize(_capacity * 2);
+        if(i < _size / 2){
+            _head = (_head - 1) & _mask;
+            _size++;
+            for(int j=0; j<i; j++) (*this)[j] = (*this)[j+1];
+        }else{
+            _size++;
+            for(int j=_size-1; j>i; j--) (*this)[j] = (*this)[j-1];
+        }
+        (*this)[i] = obj;
+        _state++;
+    }
+
+    void erase(int i){
+        if(i < _size / 2){
+            for(int j=i; j>0; j--) (*this)[j] = (*this)[j-1];
+            _head = (_head + 1) & _mask;
+        }else{
+            for(int j=i; j<_size-1; j++) (*this)[j] = (*this)[j+1];
+        }
+        _size--;
+        _state++;
+        _try_shrink();
+    }
+
+    // rotates `n` steps to the right, or to the left if `n` is negative
+    void rotate(i64 n){
+        if(_size <= 1) return;
+        n %= _size;
+        if(n < 0) n += _size;
+        if(n > _size / 2){
+            for(i64 k=_size-n; k>0; k--){
+                (*this)[_size] = _data[_head];
+                _head = (_head + 1) & _mask;
+            }
+        }else{
+            for(i64 k=n; k>0; k--){
+                _head = (_head - 1) & _mask;
+                _data[_head] = (*this)[_size];
+            }
+        }
+    }
+
+    void reverse(){
+        for(int i=0, j=_size-1; i<j; i++, j--) std::swap((*this)[i], (*this)[j]);
+    }
+
+    void clear(){
+        _head = 0;
+        _size = 0;      // nothing to copy when shrinking
+        if(_capacity != kMinCapacity) _resize(kMinCapacity);
+        _state++;
+    }
+
+    void _gc_mark() const{
+        for(int i=0; i<_size; i++) PK_OBJ_MARK((*this)[i]);
+    }
+
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
+};
+
+struct DequeIter{
+    PY_CLASS(DequeIter, _collections, _deque_iterator)
+
+    PyObject* ref;
+    int index;
+    uint32_t state; // the deque must not be mutated during iteration
+
+    DequeIter(PyObject* ref): ref(ref), index(0), state(PK_OBJ_GET(Deque, ref)._state) {}
+
+    void _gc_mark() const{ PK_OBJ_MARK(ref); }
+
+    static void _register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind_notimplemented_constructor<DequeIter>(type);
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            DequeIter& self = _CAST(DequeIter&, obj);
+            const Deque& deque = PK_OBJ_GET(Deque, self.ref);
+            if(deque._state != self.state) vm->_error("RuntimeError", "deque mutated during iteration");
+            if(self.index == deque.size()) return vm->StopIteration;
+            return deque[self.index++];
+        });
+    }
+};
+
+static void deque_extend(VM* vm, PyObject* obj, PyObject* iterable, bool left){
+    // the items are unreachable until they are pushed
+    auto _lock = vm->heap.gc_scope_lock();
+    Deque& self = _CAST(Deque&, obj);
+    if(iterable == obj){
+        Deque other(self);
+        for(int i=0; i<other.size(); i++){
+            if(left) self.push_front(other[i]); else self.push_back(other[i]);
+        }
+    }else{
+        PyObject* it = vm->py_iter(iterable);
+        PyObject* item = vm->py_next(it);
+        while(item != vm->StopIteration){
+            if(left) self.push_front(item); else self.push_back(item);
+            item = vm->py_next(it);
+        }
+    }
+    vm->heap.write_barrier(obj);
+}
+
+// returns the first index whose item equals `value`, or -1
+static int deque_find(VM* vm, PyObject* obj, PyObject* value, int start=0, int stop=-1){
+    const Deque& self = _CAST(Deque&, obj);
+    uint32_t state = self._state;
+    if(stop < 0 || stop > self.size()) stop = self.size();
+    for(int i=start; i<stop; i++){
+        bool ok = vm->py_equals(self[i], value);
+        if(self._state != state) vm->_error("RuntimeError", "deque mutated during iteration");
+        if(ok) return i;
+    }
+    return -1;
+}
+
+void Deque::_register(VM* vm, PyObject* mod, PyObject* type){
+    vm->bind(type, "__new__(cls, iterable=None, maxlen=None)", [](VM* vm, ArgsView args){
+        int maxlen = -1;
+        if(args[2] != vm->None){
+            maxlen = CAST(int, args[2]);
+            if(maxlen < 0) vm->ValueError("maxlen must be non-negative");
+        }
+        PyObject* obj = vm->heap.gcnew<Deque>(PK_OBJ_GET(Type, args[0]), maxlen);
+        if(args[1] != vm->None) deque_extend(vm, obj, args[1], false);
+        return obj;
+    });
+
+    vm->bind_method<1>(type, "append", [](VM* vm, ArgsView args){
+        _CAST(Deque&, args[0]).push_back(args[1]);
+        vm->heap.write_barrier(args[0]);
+        return vm->None;
+    });
+
+    vm->bind_method<1>(type, "appendleft", [](VM* vm, ArgsView args){
+        _CAST(Deque&, args[0]).push_front(args[1]);
+        vm->heap.write_barrier(args[0]);
+        return vm->None;
+    });
+
+    vm->bind_method<0>(type, "pop", [](VM* vm, ArgsView args){
+        Deque& self = _CAST(Deque&, args[0]);
+        if(self.size() == 0) vm->IndexError("pop from an empty deque");
+        return self.pop_back();
+    });
+
+    vm->bind_method<0>(type, "popleft", [](VM* vm, ArgsView args){
+        Deque& self = _CAST(Deque&, args[0]);
+        if(self.size() == 0) vm->IndexError("pop from an empty deque");
+        return self.pop_front();
+    });
+
+    vm->bind_method<1>(type, "extend", [](VM* vm, ArgsView args){
+        deque_extend(vm, args[0], args[1], false);
+        return vm->None;
+    });
+
+    vm->bind_method<1>(type, "extendleft", [](VM* vm, ArgsView args){
+        deque_extend(vm, args[0], args[1], true);
+        return vm->None;
+    });
+
+    vm->bind_method<0>(type, "clear", [](VM* vm, ArgsView args){
+        _CAST(Deque&, args[0]).clear();
+        return vm->None;
+    });
+
+    vm->bind_method<0>(type, "copy", [](VM* vm, ArgsView args){
+        const Deque& self = _CAST(Deque&, args[0]);
+        return vm->heap.gcnew<Deque>(vm->_tp(args[0]), self);
+    });
+
+    vm->bind_method<1>(type, "count", [](VM* vm, ArgsView args){
+        int count = 0;
+        int i = deque_find(vm, args[0], args[1]);
+        while(i >= 0){
+            count++;
+            i = deque_find(vm, args[0], args[1], i+1);
+        }
+        return VAR(count);
+    });
+
+    vm->bind(type, "index(self, value, start=0, stop=None)", [](VM* vm, ArgsView args){
+        int n = _CAST(Deque&, args[0]).size();
+        int start = CAST(int, args[2]);
+        int stop = args[3] == vm->None ? n : CAST(int, args[3]);
+        if(start < 0) start = std::max(start + n, 0);
+        if(stop < 0) stop = std::max(stop + n, 0);
+        int i = deque_find(vm, args[0], args[1], start, stop);
+        if(i < 0) vm->ValueError(CAST(Str&, vm->py_repr(args[1])) + " is not in deque");
+        return VAR(i);
+    });
+
+    vm->bind_method<2>(type, "insert", [](VM* vm, ArgsView args){
+        Deque& self = _CAST(Deque&, args[0]);
+        int index = CAST(int, args[1]);
+        if(index < 0) index += self.size();
+        if(index < 0) index = 0;
+        if(index > self.size()) index = self.size();
+        if(self.size() == self.maxlen) vm->IndexError("deque already at its maximum size");
+        self.insert(index, args[2]);
+        vm->heap.write_barrier(args[0]);
+        return vm->None;
+    });
+
+    vm->bind_method<1>(type, "remove", [](VM* vm, ArgsView args){
+        int i = deque_find(vm, args[0], args[1]);
+        if(i < 0) vm->ValueError(CAST(Str&, vm->py_repr(args[1])) + " is not in deque");
+        _CAST(Deque&, args[0]).erase(i);
+        return vm->None;
+    });
+
+    vm->bind_method<0>(type, "reverse", [](VM* vm, ArgsView args){
+        _CAST(Deque&, args[0]).reverse();
+        return vm->None;
+    });
+
+    vm->bind(type, "rotate(self, n=1)", [](VM* vm, ArgsView args){
+        _CAST(Deque&, args[0]).rotate(CAST(i64, args[1]));
+        return vm->None;
+    });
+
+    vm->bind_property(type, "maxlen", [](VM* vm, ArgsView args){
+        const Deque& self = _CAST(Deque&, args[0]);
+        if(self.maxlen < 0) return vm->None;
+        return VAR(self.maxlen);
+    });
+
+    vm->bind_method<0>(type, "__getnewargs__", [](VM* vm, ArgsView args){
+        const Deque& self = _CAST(Deque&, args[0]);
+        List items(self.size());
+        for(int i=0; i<self.size(); i++) items[i] = self[i];
+        PyObject* maxlen = self.maxlen < 0 ? vm->None : VAR(self.maxlen);
+        return VAR(Tuple({VAR(std::move(items)), maxlen}));
+    });
+
+    Type t = PK_OBJ_GET(Type, type);
+
+    vm->bind__len__(t, [](VM* vm, PyObject* obj){
+        return (i64)_CAST(Deque&, obj).size();
+    });
+
+    vm->bind__getitem__(t, [](VM* vm, PyObject* obj, PyObject* index){
+        Deque& self = _CAST(Deque&, obj);
+        int i = vm->normalized_index(CAST(int, index), self.size());
+        return self[i];
+    });
+
+    vm->bind__setitem__(t, [](VM* vm, PyObject* obj, PyObject* index, PyObject* value){
+        Deque& self = _CAST(Deque&, obj);
+        int i = vm->normalized_index(CAST(int, index), self.size());
+        self[i] = value;
+        vm->heap.write_barrier(obj);
+    });
+
+    vm->bind__delitem__(t, [](VM* vm, PyObject* obj, PyObject* index){
+        Deque& self = _CAST(Deque&, obj);
+        int i = vm->normalized_index(CAST(int, index), self.size());
+        self.erase(i);
+    });
+
+    vm->bind__contains__(t, [](VM* vm, PyObject* obj, PyObject* value){
+        return VAR(deque_find(vm, obj, value) >= 0);
+    });
+
+    vm->bind__iter__(t, [](VM* vm, PyObject* obj){
+        return VAR_T(DequeIter, obj);
+    });
+
+    vm->bind__repr__(t, [](VM* vm, PyObject* obj){
+        const Deque& self = _CAST(Deque&, obj);
+        std::stringstream ss;
+        ss << "deque([";
+        for(int i=0; i<self.size(); i++){
+            if(i > 0) ss << ", ";
+            ss << CAST(Str&, vm->py_repr(self[i]));
+        }
+        ss << "]";
+        if(self.maxlen >= 0) ss << ", maxlen=" << self.maxlen;
+        ss << ")";
+        return VAR(ss.str());
+    });
+
+    vm->bind__eq__(t, [](VM* vm, PyObject* a, PyObject* b){
+        if(!vm->isinstance(b, Deque::_type(vm))) return vm->NotImplemented;
+        const Deque& self = _CAST(Deque&, a);
+        const Deque& other = _CAST(Deque&, b);
+        int n = self.size();
+        if(n != other.size()) return vm->False;
+        for(int i=0; i<n; i++){
+            bool ok = vm->py_equals(self[i], other[i]);
+            if(self.size() != n || other.size() != n) vm->_error("RuntimeError", "deque mutated during iteration");
+            if(!ok) return vm->False;
+        }
+        return vm->True;
+    });
+}
+
+void add_module_collections(VM* vm){
+    PyObject* mod = vm->new_module("_collections");
+    Deque::register_class(vm, mod);
+    DequeIter::register_class(vm, mod);
+}
+
+/************ heapq ************/
+// https://github.com/python/cpython/blob/3.11/Modules/_heapqmodule.c
+static bool heap_lt(VM* vm, PyObject* a, PyObject* b){
+    if(is_small_int(a) && is_small_int(b)) return PK_BITS(a) < PK_BITS(b);
+    if(is_float(a) && is_float(b)) return untag_float(a) < untag_float(b);
+    return vm->py_lt(a, b);
+}
+
+static List& heap_of(VM* vm, PyObject* obj){
+    if(!is_non_tagged_type(obj, vm->tp_list)) vm->TypeError("heap argument must be a list");
+    return PK_OBJ_GET(List, obj);
+}
+
+// `__lt__` may run python code which changes the list
+#define HEAP_CHECK_SIZE(heap, n) \
+    if(heap.size() != n) vm->_error("RuntimeError", "list changed size during iteration");
+
+// `heap` is a heap at all indices >= `startpos`, except possibly for `pos`
+static void heap_siftdown(VM* vm, List& heap, int startpos, int pos){
+    int n = heap.size();
+    PyObject* newitem = heap[pos];
+    while(pos > startpos){
+        int parentpos = (pos - 1) >> 1;
+        PyObject* parent = heap[parentpos];
+        bool lt = heap_lt(vm, newitem, parent);
+        HEAP_CHECK_SIZE(heap, n)
+        if(!lt) break;
+        heap[pos] = parent;
+        pos = parentpos;
+    }
+    heap[pos] = newitem;
+}
+
+static void heap_siftup(VM* vm, List& heap, int pos){
+    int n = heap.size();
+    int startpos = pos;
+    PyObject* newitem = heap[pos];
+    // bubble up the smaller child until hitting a leaf
+    int childpos = 2*pos + 1;
+    while(childpos < n){
+        int rightpos = childpos + 1;
+        if(rightpos < n){
+            bool lt = heap_lt(vm, heap[childpos], heap[rightpos]);
+            HEAP_CHECK_SIZE(heap, n)
+            if(!lt) childpos = rightpos;
+        }
+        heap[pos] = heap[childpos];
+        pos = childpos;
+        childpos = 2*pos + 1;
+    }
+    heap[pos] = newitem;
+    heap_siftdown(vm, heap, startpos, pos);
+}
+
+#undef HEAP_CHECK_SIZE
+
+void add_module_heapq(VM* vm){
+    PyObject* mod = vm->new_module("_heapq");
+
+    vm->bind_func<2>(mod, "heappush", [](VM* vm, ArgsView args){
+        List& heap = heap_of(vm, args[0]);
+        auto _lock = vm->heap.gc_scope_lock();
+        heap.push_back(args[1]);
+        vm->heap.write_barrier(args[0]);
+        heap_siftdown(vm, heap, 0, heap.size()-1);
+        return vm->None;
+    });
+
+    vm->bind_func<1>(mod, "heappop", [](VM* vm, ArgsView args){
+        List& heap = heap_of(vm, args[0]);
+        if(heap.empty()) vm->IndexError("index out of range");
+        auto _lock = vm->heap.gc_scope_lock();
+        PyObject* lastelt = heap.back();
+        heap.pop_back();
+        if(heap.empty()) return lastelt;
+        PyObject* returnitem = heap[0];
+        heap[0] = lastelt;
+        heap_siftup(vm, heap, 0);
+        return returnitem;
+    });
+
+    vm->bind_func<2>(mod, "heapreplace", [](VM* vm, ArgsView args){
+        List& heap = heap_of(vm, args[0]);
+        if(heap.empty()) vm->IndexError("index out of range");
+        auto _lock = vm->heap.gc_scope_lock();
+        PyObject* returnitem = heap[0];
+        heap[0] = args[1];
+        vm->heap.write_barrier(args[0]);
+        heap_siftup(vm, heap, 0);
+        return returnitem;
+    });
+
+    vm->bind_func<2>(mod, "heappushpop", [](VM* vm, ArgsView args){
+        List& heap = heap_of(vm, args[0]);
+        PyObject* item = args[1];
+        if(heap.empty()) return item;
+        auto _lock = vm->heap.gc_scope_lock();
+        bool lt = heap_lt(vm, heap[0], item);
+        if(heap.empty()) vm->IndexError("index out of range");
+        if(!lt) return item;
+        std::swap(item, heap[0]);
+        vm->heap.write_barrier(args[0]);
+        heap_siftup(vm, heap, 0);
+        return item;
+    });
+
+    vm->bind_func<1>(mod, "heapify", [](VM* vm, ArgsView args){
+        List& heap = heap_of(vm, args[0]);
+        auto _lock = vm->heap.gc_scope_lock();
+        for(int i=heap.size()/2-1; i>=0; i--) heap_siftup(vm, heap, i);
+        return vm->None;
+    });
+}
+
+/************ bisect ************/
+// lists and tuples are searched in place, other sequences go through `__getitem__`
+static int bisect_impl(VM* vm, ArgsView args, bool right){
+    PyObject* a = args[0];
+    PyObject* x = args[1];
+    i64 lo = CAST(i64, args[2]);
+    if(lo < 0) vm->ValueError("lo must be non-negative");
+    i64 hi;
+    if(args[3] == vm->None){
+        const PyTypeInfo* ti = vm->_inst_type_info(a);
+        hi = ti->m__len__ ? ti->m__len__(vm, a) : CAST(i64, vm->call_method(a, __len__));
+    }else{
+        hi = CAST(i64, args[3]);
+    }
+    PyObject** items = nullptr;
+    int n = 0;
+    if(is_non_tagged_type(a, vm->tp_list)){
+        List& list = PK_OBJ_GET(List, a);
+        items = list.data();
+        n = list.size();
+    }else if(is_non_tagged_type(a, vm->tp_tuple)){
+        Tuple& tuple = PK_OBJ_GET(Tuple, a);
+        items = tuple.begin();
+        n = tuple.size();
+    }
+    auto _lock = vm->heap.gc_scope_lock();
+    while(lo < hi){
+        i64 mid = (lo + hi) / 2;
+        PyObject* item;
+        if(items != nullptr){
+            // `__lt__` may run python code which resizes the list
+            if(is_non_tagged_type(a, vm->tp_list)){
+                List& list = PK_OBJ_GET(List, a);
+                items = list.data();
+                n = list.size();
+            }
+            if(mid >= n) vm->IndexError("list index out of range");
+            item = items[mid];
+        }else{
+            item = vm->call_method(a, __getitem__, VAR(mid));
+        }
+        if(right){
+            if(heap_lt(vm, x, item)) hi = mid; else lo = mid + 1;
+        }else{
+            if(heap_lt(vm, item, x)) lo = mid + 1; else hi = mid;
+        }
+    }
+    return (int)lo;
+}
+
+static void insort_impl(VM* vm, ArgsView args, bool right){
+    int i = bisect_impl(vm, args, right);
+    if(is_non_tagged_type(args[0], vm->tp_list)){
+        PK_OBJ_GET(List, args[0]).insert(i, args[1]);
+        vm->heap.write_barrier(args[0]);
+    }else{
+        vm->call_method(args[0], "insert", VAR(i), args[1]);
+    }
+}
+
+void add_module_bisect(VM* vm){
+    PyObject* mod = vm->new_module("_bisect");
+
+    vm->bind(mod, "bisect_left(a, x, lo=0, hi=None)", [](VM* vm, ArgsView args){
+        return VAR(bisect_impl(vm, args, false));
+    });
+
+    vm->bind(mod, "bisect_right(a, x, lo=0, hi=None)", [](VM* vm, ArgsView args){
+        return VAR(bisect_impl(vm, args, true));
+    });
+
+    vm->bind(mod, "insort_left(a, x, lo=0, hi=None)", [](VM* vm, ArgsView args){
+        insort_impl(vm, args, false);
+        return vm->None;
+    });
+
+    vm->bind(mod, "insort_right(a, x, lo=0, hi=None)", [](VM* vm, ArgsView args){
+        insort_impl(vm, args, true);
+        return vm->None;
+    });
+
+    mod->attr().set("bisect", mod->attr("bisect_right"));
+    mod->attr().set("insort", mod->attr("insort_right"));
+}
+
+}   // namespace pkpy
@@ -10,15 +10,14 @@ namespace pkpy{
 
     CodeObject_ Compiler::push_global_context(){
         CodeObject_ co = std::make_shared<CodeObject>(lexer->src, lexer->src->filename);
-        contexts.push(CodeEmitContext(vm, co, contexts.size()));
+        contexts.push(CodeEmitContext(vm, co, contexts.size(), nullptr));
         return co;
     }
 
     FuncDecl_ Compiler::push_f_context(Str name){
         FuncDecl_ decl = std::make_shared<FuncDecl>();
         decl->code = std::make_shared<CodeObject>(lexer->src, name);
-        decl->nested = name_scope() == NAME_LOCAL;
-        contexts.push(CodeEmitContext(vm, decl->code, contexts.size()));
+        contexts.push(CodeEmitContext(vm, decl->code, contexts.size(), ctx()));
         return decl;
     }
 
@@ -31,10 +30,25 @@ namespace pkpy{
         // however, this is buggy...since there may be a jump to the end (out of bound) even if the last opcode is a return
         ctx()->emit(OP_LOAD_NONE, BC_NOARG, BC_KEEPLINE);
         ctx()->emit(OP_RETURN_VALUE, BC_NOARG, BC_KEEPLINE);
-        // ctx()->co->optimize(vm);
+        // a local may become a cell after its first use, when a nested function captures it
+        CodeObject* co = ctx()->co.get();
+        if(!co->cellvars.empty() || !co->freevars.empty()){
+            std::vector<bool> is_cell(co->varnames.size(), false);
+            for(int index: co->cellvars) is_cell[index] = true;
+            for(FreeVar fv: co->freevars) is_cell[fv.index] = true;
+            for(Bytecode& byte: co->codes){
+                if(byte.op != OP_LOAD_FAST && byte.op != OP_STORE_FAST && byte.op != OP_DELETE_FAST) continue;
+                if(!is_cell[byte.arg]) continue;
+                if(byte.op == OP_LOAD_FAST) byte.op = OP_LOAD_DEREF;
+                else if(byte.op == OP_STORE_FAST) byte.op = OP_STORE_DEREF;
+                else byte.op = OP_DELETE_DEREF;
+            }
+        }
+        ctx()->co->optimize();
         if(ctx()->co->varnames.size() > PK_MAX_CO_VARNAMES){
             SyntaxError("maximum number of local variables exceeded");
         }
+        ctx()->co->_alloc_attr_caches();
         contexts.pop();
     }
 
@@ -270,8 +284,33 @@ namespace pkpy{
         ctx()->s_expr.push(std::move(g));
     }
 
+    // the element of a comprehension is parsed before its `for` clause, declare the
+    // loop variables first so that lambdas in the element capture them
+    void Compiler::_declare_comp_vars() {
+        if(name_scope() != NAME_LOCAL || ctx()->is_compiling_class) return;
+        int depth = 0;
+        for(int j=i; j<(int)tokens.size(); j++){
+            TokenIndex type = tokens[j].type;
+            if(type == TK("(") || type == TK("[") || type == TK("{")) depth++;
+            else if(type == TK(")") || type == TK("]") || type == TK("}")){
+                if(--depth < 0) return;
+            }
+            else if(type == TK("@eof")) return;
+            else if(depth == 0 && type == TK("for")){
+                for(j++; j<(int)tokens.size() && tokens[j].type != TK("in"); j++){
+                    if(tokens[j].type != TK("@id")) continue;
+                    Str name = tokens[j].str();
+                    if(ctx()->global_names.count(name)) continue;
+                    if(ctx()->co->varnames_inv.try_get(name) < 0) ctx()->add_varname(name);
+                }
+                return;
+            }
+        }
+    }
+
     void Compiler::exprList() {
         int line = prev().line;
+        _declare_comp_vars();
         std::vector<Expr_> items;
         do {
             match_newlines_repl();
@@ -294,6 +333,7 @@ namespace pkpy{
 
     void Compiler::exprMap() {
         bool parsing_dict = false;  // {...} may be dict or set
+        _declare_comp_vars();
         std::vector<Expr_> items;
         do {
             match_newlines_repl();
@@ -776,9 +816,11 @@ __EAT_DOTS_END:
                 consume(TK("@id"));
                 StrName name(prev().sv());
                 switch(name_scope()){
-                    case NAME_LOCAL:
-                        ctx()->emit(OP_INC_FAST, ctx()->add_varname(name), prev().line);
-                        break;
+                    case NAME_LOCAL: {
+                        int index = ctx()->add_varname_for_store(name);
+                        if(index < 0) SyntaxError();
+                        ctx()->emit(OP_INC_FAST, index, prev().line);
+                    } break;
                     case NAME_GLOBAL:
                         ctx()->emit(OP_INC_GLOBAL, name.index, prev().line);
                         break;
@@ -791,9 +833,11 @@ __EAT_DOTS_END:
                 consume(TK("@id"));
                 StrName name(prev().sv());
                 switch(name_scope()){
-                    case NAME_LOCAL:
-                        ctx()->emit(OP_DEC_FAST, ctx()->add_varname(name), prev().line);
-                        break;
+                    case NAME_LOCAL: {
+                        int index = ctx()->add_varname_for_store(name);
+                        if(index < 0) SyntaxError();
+                        ctx()->emit(OP_DEC_FAST, index, prev().line);
+                    } break;
                     case NAME_GLOBAL:
                         ctx()->emit(OP_DEC_GLOBAL, name.index, prev().line);
                         break;
@@ -814,6 +858,21 @@ __EAT_DOTS_END:
                 } while (match(TK(",")));
                 consume_end_stmt();
                 break;
+            case TK("nonlocal"):
+                do {
+                    consume(TK("@id"));
+                    StrName name(prev().sv());
+                    if(ctx()->nonlocal_names.count(name)) continue;
+                    if(ctx()->co->varnames_inv.try_get(name) >= 0){
+                        SyntaxError(fmt("name ", name.escape(), " is used prior to nonlocal declaration"));
+                    }
+                    if(ctx()->add_freevar(name) < 0){
+                        SyntaxError(fmt("no binding for nonlocal ", name.escape(), " found"));
+                    }
+                    ctx()->nonlocal_names.insert(name);
+                } while (match(TK(",")));
+                consume_end_stmt();
+                break;
             case TK("raise"): {
                 consume(TK("@id"));
                 int dummy_t = StrName(prev().str()).index;
@@ -990,6 +1049,10 @@ __EAT_DOTS_END:
         const char* _start = curr().start;
         consume(TK("@id"));
         Str decl_name = prev().str();
+        // so that a nested function can call itself through its cell
+        if(name_scope() == NAME_LOCAL && !ctx()->is_compiling_class && !ctx()->global_names.count(decl_name)){
+            ctx()->add_varname(decl_name);
+        }
         FuncDecl_ decl = push_f_context(decl_name);
         consume(TK("("));
         if (!match(TK(")"))) {
@@ -1000,8 +1063,8 @@ __EAT_DOTS_END:
         const char* _end = curr().start;
         decl->signature = Str(_start, _end-_start);
         compile_block_body();
-        pop_context();
 
+        // strip the docstring before `pop_context()` optimizes it out
         PyObject* docstring = nullptr;
         if(decl->code->codes.size()>=2 && decl->code->codes[0].op == OP_LOAD_CONST && decl->code->codes[1].op == OP_POP_TOP){
             PyObject* c = decl->code->consts[decl->code->codes[0].arg];
@@ -1014,6 +1077,7 @@ __EAT_DOTS_END:
         if(docstring != nullptr){
             decl->docstring = PK_OBJ_GET(Str, docstring);
         }
+        pop_context();
         ctx()->emit(OP_LOAD_FUNCTION, ctx()->add_func_decl(decl), prev().line);
 
         // add decorators
@@ -1026,7 +1090,8 @@ __EAT_DOTS_END:
         }
         if(!ctx()->is_compiling_class){
             auto e = make_expr<NameExpr>(decl_name, name_scope());
-            e->emit_store(ctx());
+            bool ok = e->emit_store(ctx());
+            if(!ok) SyntaxError();
         }else{
             int index = StrName(decl_name).index;
             ctx()->emit(OP_STORE_CLASS_ATTR, index, prev().line);
@@ -2,131 +2,115 @@
 
 namespace pkpy{
 
-    Dict::Dict(VM* vm): vm(vm), _capacity(__Capacity),
-            _mask(__Capacity-1),
-            _size(0), _critical_size(__Capacity*__LoadFactor+0.5f), _head_idx(-1), _tail_idx(-1){
-        _items = (Item*)pool128_alloc(_capacity * sizeof(Item));
-        memset(_items, 0, _capacity * sizeof(Item));
-        _nodes = (ItemNode*)pool64_alloc(_capacity * sizeof(ItemNode));
-        memset(_nodes, -1, _capacity * sizeof(ItemNode));
+    Dict::Dict(VM* vm): vm(vm){
+        _alloc(__Capacity);
     }
 
     Dict::Dict(Dict&& other){
-        vm = other.vm;
-        _capacity = other._capacity;
-        _mask = other._mask;
-        _size = other._size;
-        _critical_size = other._critical_size;
-        _head_idx = other._head_idx;
-        _tail_idx = other._tail_idx;
-        _items = other._items;
-        _nodes = other._nodes;
+        memcpy(this, &other, sizeof(Dict));
+        other._indices = nullptr;
         other._items = nullptr;
-        other._nodes = nullptr;
     }
 
     Dict::Dict(const Dict& other){
-        vm = other.vm;
-        _capacity = other._capacity;
-        _mask = other._mask;
-        _size = other._size;
-        _critical_size = other._critical_size;
-        _head_idx = other._head_idx;
-        _tail_idx = other._tail_idx;
-        _items = (Item*)pool128_alloc(_capacity * sizeof(Item));
-        memcpy(_items, other._items, _capacity * sizeof(Item));
-        _nodes = (ItemNode*)pool64_alloc(_capacity * sizeof(ItemNode));
-        memcpy(_nodes, other._nodes, _capacity * sizeof(ItemNode));
+        memcpy(this, &other, sizeof(Dict));
+        _indices = pool64_alloc(_capacity * _index_bytes);
+        memcpy(_indices, other._indices, _capacity * _index_bytes);
+        _items = (Item*)pool128_alloc(_critical_size * sizeof(Item));
+        memcpy(_items, other._items, _items_len * sizeof(Item));
+    }
+
+    void Dict::_alloc(int capacity){
+        _capacity = capacity;
+        _mask = capacity - 1;
+        _size = 0;
+        _critical_size = capacity*__LoadFactor+0.5f;
+        _items_len = 0;
+        // entry indices are below `_critical_size`
+        if(capacity <= 128) _index_bytes = 1;
+        else if(capacity <= 32768) _index_bytes = 2;
+        else _index_bytes = 4;
+        _indices = pool64_alloc(capacity * _index_bytes);
+        memset(_indices, -1, capacity * _index_bytes);     // kEmptySlot
+        _items = (Item*)pool128_alloc(_critical_size * sizeof(Item));
     }
 
     void Dict::set(PyObject* key, PyObject* val){
-        // do possible rehash
-        if(_size+1 > _critical_size) _rehash();
+        i64 hash = _hash(key);
         bool ok; int i;
-        _probe_1(key, ok, i);
-        if(!ok) {
-            _size++;
-            _items[i].first = key;
-
-            // append to tail
-            if(_size == 0+1){
-                _head_idx = i;
-                _tail_idx = i;
-            }else{
-                _nodes[i].prev = _tail_idx;
-                _nodes[_tail_idx].next = i;
-                _tail_idx = i;
-            }
+        _probe_1(key, hash, ok, i);
+        if(ok){
+            _items[_index_at(i)].second = val;
+            return;
         }
-        _items[i].second = val;
+        if(_items_len == _critical_size){
+            _rehash(_size + 1);
+            _probe_1(key, hash, ok, i);
+        }
+        int ix = _items_len++;
+        _items[ix] = {key, val, hash};
+        _set_index(i, ix);
+        _size++;
     }
 
-    void Dict::_rehash(){
+    // rebuild the tables to hold `n` entries, dropping the deleted ones
+    void Dict::_rehash(int n){
+        void* old_indices = _indices;
         Item* old_items = _items;
-        ItemNode* old_nodes = _nodes;
-        int old_head_idx = _head_idx;
-
-        _capacity *= 2;
-        _mask = _capacity - 1;
-        _size = 0;
-        _critical_size = _capacity*__LoadFactor+0.5f;
-        _head_idx = -1;
-        _tail_idx = -1;
-        
-        _items = (Item*)pool128_alloc(_capacity * sizeof(Item));
-        memset(_items, 0, _capacity * sizeof(Item));
-        _nodes = (ItemNode*)pool64_alloc(_capacity * sizeof(ItemNode));
-        memset(_nodes, -1, _capacity * sizeof(ItemNode));
-
-        // copy old items to new dict
-        int i = old_head_idx;
-        while(i != -1){
-            set(old_items[i].first, old_items[i].second);
-            i = old_nodes[i].next;
+        int old_items_len = _items_len;
+
+        int capacity = __Capacity;
+        while(capacity < n * 2) capacity *= 2;
+        _alloc(capacity);
+
+        for(int j=0; j<old_items_len; j++){
+            const Item& item = old_items[j];
+            if(item.first == nullptr) continue;
+            int i = item.hash & _mask;
+            while(_index_at(i) != kEmptySlot){
+                // https://github.com/python/cpython/blob/3.8/Objects/dictobject.c#L166
+                i = ((5*i) + 1) & _mask;
+            }
+            _items[_items_len] = item;
+            _set_index(i, _items_len);
+            _items_len++;
         }
+        _size = _items_len;
+        pool64_dealloc(old_indices);
         pool128_dealloc(old_items);
-        pool64_dealloc(old_nodes);
     }
 
-
     PyObject* Dict::try_get(PyObject* key) const{
         bool ok; int i;
-        _probe_0(key, ok, i);
+        _probe_0(key, _hash(key), ok, i);
         if(!ok) return nullptr;
-        return _items[i].second;
+        return _items[_index_at(i)].second;
     }
 
     bool Dict::contains(PyObject* key) const{
         bool ok; int i;
-        _probe_0(key, ok, i);
+        _probe_0(key, _hash(key), ok, i);
         return ok;
     }
 
     bool Dict::erase(PyObject* key){
         bool ok; int i;
-        _probe_0(key, ok, i);
+        _probe_0(key, _hash(key), ok, i);
         if(!ok) return false;
-        _items[i].first = nullptr;
-        // _items[i].second = PY_DELETED_SLOT;  // do not change .second if it is not NULL, it means the slot is occupied by a deleted item
+        Item& item = _items[_index_at(i)];
+        item.first = nullptr;
+        item.second = nullptr;
+        _set_index(i, kDeletedSlot);
         _size--;
-
-        if(_size == 0){
-            _head_idx = -1;
-            _tail_idx = -1;
-        }else{
-            if(_head_idx == i){
-                _head_idx = _nodes[i].next;
-                _nodes[_head_idx].prev = -1;
-            }else if(_tail_idx == i){
-                _tail_idx = _nodes[i].prev;
-                _nodes[_tail_idx].next = -1;
-            }else{
-                _nodes[_nodes[i].prev].next = _nodes[i].next;
-                _nodes[_nodes[i].next].prev = _nodes[i].prev;
-            }
+        // trim deleted entries at the end, so the last entry is always live.
+        // `_critical_size` goes down with `_items_len`, so the deleted slots
+        // in `_indices` are still bounded until the next rehash
+        while(_items_len > 0 && _items[_items_len-1].first == nullptr){
+            _items_len--;
+            _critical_size--;
         }
-        _nodes[i].prev = -1;
-        _nodes[i].next = -1;
+        // shrink if the dict is mostly empty
+        if(_capacity > __Capacity && _size * 8 < _capacity) _rehash(_size);
         return true;
     }
 
@@ -136,40 +120,30 @@ namespace pkpy{
 
     Tuple Dict::keys() const{
         Tuple t(_size);
-        int i = _head_idx;
         int j = 0;
-        while(i != -1){
-            t[j++] = _items[i].first;
-            i = _nodes[i].next;
-        }
+        apply([&](PyObject* k, PyObject* v){ t[j++] = k; });
         PK_ASSERT(j == _size);
         return t;
     }
 
     Tuple Dict::values() const{
         Tuple t(_size);
-        int i = _head_idx;
         int j = 0;
-        while(i != -1){
-            t[j++] = _items[i].second;
-            i = _nodes[i].next;
-        }
+        apply([&](PyObject* k, PyObject* v){ t[j++] = v; });
         PK_ASSERT(j == _size);
         return t;
     }
 
     void Dict::clear(){
-        _size = 0;
-        _head_idx = -1;
-        _tail_idx = -1;
-        memset(_items, 0, _capacity * sizeof(Item));
-        memset(_nodes, -1, _capacity * sizeof(ItemNode));
+        pool64_dealloc(_indices);
+        pool128_dealloc(_items);
+        _alloc(__Capacity);
     }
 
     Dict::~Dict(){
         if(_items==nullptr) return;
+        pool64_dealloc(_indices);
         pool128_dealloc(_items);
-        pool64_dealloc(_nodes);
     }
 
     void Dict::_gc_mark() const{
@@ -179,4 +153,4 @@ namespace pkpy{
         });
     }
 
-}   // namespace pkpy
\ No newline at end of file
+}   // namespace pkpy
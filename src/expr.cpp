@@ -62,6 +62,18 @@ namespace pkpy{
         return i;
     }
 
+    // emit a folded constant
+    void CodeEmitContext::emit_const(PyObject* obj, int line){
+        if(is_small_int(obj)){
+            i64 val = PK_BITS(obj) >> 2;
+            if(val >= INT16_MIN && val <= INT16_MAX){
+                emit(OP_LOAD_INTEGER, (int)val, line);
+                return;
+            }
+        }
+        emit(OP_LOAD_CONST, add_const(obj), line);
+    }
+
     void CodeEmitContext::patch_jump(int index) {
         int target = co->codes.size();
         co->codes[index].arg = target;
@@ -82,6 +94,39 @@ namespace pkpy{
         return index;
     }
 
+    // if `name` is a local of an enclosing function, it becomes a free variable here
+    // and a cell there, returns its index in varnames or -1
+    int CodeEmitContext::add_freevar(StrName name){
+        // functions defined in the global scope have no free variables
+        if(parent == nullptr || parent->parent == nullptr) return -1;
+        if(parent->global_names.count(name.sv())) return -1;
+        int source = parent->co->varnames_inv.try_get(name);
+        if(source < 0){
+            source = parent->add_freevar(name);
+            if(source < 0) return -1;
+        }else if(!parent->is_freevar(source)){
+            pod_vector<int>& cellvars = parent->co->cellvars;
+            if(std::find(cellvars.begin(), cellvars.end(), source) == cellvars.end()){
+                cellvars.push_back(source);
+            }
+        }
+        int index = add_varname(name);
+        co->freevars.push_back(FreeVar{index, source});
+        return index;
+    }
+
+    // a free variable can be assigned only if it is declared `nonlocal`, returns -1 otherwise
+    int CodeEmitContext::add_varname_for_store(StrName name){
+        int index = add_varname(name);
+        if(is_freevar(index) && !nonlocal_names.count(name)) return -1;
+        return index;
+    }
+
+    bool CodeEmitContext::is_freevar(int index) const{
+        for(FreeVar fv: co->freevars) if(fv.index == index) return true;
+        return false;
+    }
+
     int CodeEmitContext::add_const(PyObject* v){
         // simple deduplication, only works for int/float
         for(int i=0; i<co->consts.size(); i++){
@@ -92,28 +137,36 @@ namespace pkpy{
     }
 
     int CodeEmitContext::add_func_decl(FuncDecl_ decl){
+        decl->_init_is_simple();
         co->func_decls.push_back(decl);
         return co->func_decls.size() - 1;
     }
 
 
     void NameExpr::emit(CodeEmitContext* ctx) {
-        int index = ctx->co->varnames_inv.try_get(name);
-        if(scope == NAME_LOCAL && index >= 0){
-            ctx->emit(OP_LOAD_FAST, index, line);
-        }else{
-            Opcode op = ctx->level <= 1 ? OP_LOAD_GLOBAL : OP_LOAD_NONLOCAL;
-            // we cannot determine the scope when calling exec()/eval()
-            if(scope == NAME_GLOBAL_UNKNOWN) op = OP_LOAD_NAME;
-            ctx->emit(op, StrName(name).index, line);
+        if(scope == NAME_LOCAL){
+            int index = ctx->co->varnames_inv.try_get(name);
+            if(index < 0) index = ctx->add_freevar(name);
+            // `Compiler::pop_context()` turns it into `LOAD_DEREF` for cells
+            if(index >= 0){
+                ctx->emit(OP_LOAD_FAST, index, line);
+                return;
+            }
         }
+        // we cannot determine the scope when calling exec()/eval()
+        Opcode op = scope == NAME_GLOBAL_UNKNOWN ? OP_LOAD_NAME : OP_LOAD_GLOBAL;
+        ctx->emit(op, StrName(name).index, line);
     }
 
+
+
     bool NameExpr::emit_del(CodeEmitContext* ctx) {
         switch(scope){
-            case NAME_LOCAL:
-                ctx->emit(OP_DELETE_FAST, ctx->add_varname(name), line);
-                break;
+            case NAME_LOCAL: {
+                int index = ctx->add_varname_for_store(name);
+                if(index < 0) return false;
+                ctx->emit(OP_DELETE_FAST, index, line);
+            } break;
             case NAME_GLOBAL:
                 ctx->emit(OP_DELETE_GLOBAL, StrName(name).index, line);
                 break;
@@ -132,9 +185,11 @@ namespace pkpy{
             return true;
         }
         switch(scope){
-            case NAME_LOCAL:
-                ctx->emit(OP_STORE_FAST, ctx->add_varname(name), line);
-                break;
+            case NAME_LOCAL: {
+                int index = ctx->add_varname_for_store(name);
+                if(index < 0) return false;
+                ctx->emit(OP_STORE_FAST, index, line);
+            } break;
             case NAME_GLOBAL:
                 ctx->emit(OP_STORE_GLOBAL, StrName(name).index, line);
                 break;
@@ -191,6 +246,25 @@ namespace pkpy{
         }
     }
 
+    PyObject* Expr::fold(CodeEmitContext* ctx){
+        VM* vm = ctx->vm;
+        TokenValue value;
+        if(!fold_value(ctx, value)) return nullptr;
+        if(std::holds_alternative<i64>(value)) return VAR(std::get<i64>(value));
+        if(std::holds_alternative<f64>(value)) return VAR(std::get<f64>(value));
+        return VAR(std::move(std::get<Str>(value)));
+    }
+
+    PyObject* Literal0Expr::fold(CodeEmitContext* ctx){
+        switch (token) {
+            case TK("None"):    return ctx->vm->None;
+            case TK("True"):    return ctx->vm->True;
+            case TK("False"):   return ctx->vm->False;
+            case TK("..."):     return ctx->vm->Ellipsis;
+            default: FATAL_ERROR();
+        }
+    }
+
     void LongExpr::emit(CodeEmitContext* ctx) {
         VM* vm = ctx->vm;
         ctx->emit(OP_LOAD_CONST, ctx->add_const(VAR(s)), line);
@@ -224,30 +298,38 @@ namespace pkpy{
         ctx->emit(OP_LOAD_CONST, ctx->add_const(obj), line);
     }
 
+    bool LiteralExpr::fold_value(CodeEmitContext* ctx, TokenValue& out){
+        PK_UNUSED(ctx);
+        if(std::holds_alternative<std::monostate>(value)) return false;
+        out = value;
+        return true;
+    }
+
     void NegatedExpr::emit(CodeEmitContext* ctx){
-        VM* vm = ctx->vm;
-        // if child is a int of float, do constant folding
-        if(child->is_literal()){
-            LiteralExpr* lit = static_cast<LiteralExpr*>(child.get());
-            if(std::holds_alternative<i64>(lit->value)){
-                i64 _val = -std::get<i64>(lit->value);
-                if(_val >= INT16_MIN && _val <= INT16_MAX){
-                    ctx->emit(OP_LOAD_INTEGER, (int)_val, line);
-                }else{
-                    ctx->emit(OP_LOAD_CONST, ctx->add_const(VAR(_val)), line);
-                }
-                return;
-            }
-            if(std::holds_alternative<f64>(lit->value)){
-                PyObject* obj = VAR(-std::get<f64>(lit->value));
-                ctx->emit(OP_LOAD_CONST, ctx->add_const(obj), line);
-                return;
-            }
+        PyObject* obj = fold(ctx);
+        if(obj != nullptr){
+            ctx->emit_const(obj, line);
+            return;
         }
         child->emit(ctx);
         ctx->emit(OP_UNARY_NEGATIVE, BC_NOARG, line);
     }
 
+    bool NegatedExpr::fold_value(CodeEmitContext* ctx, TokenValue& out){
+        if(!child->fold_value(ctx, out)) return false;
+        if(std::holds_alternative<i64>(out)){
+            i64 val = std::get<i64>(out);
+            if(val == INT64_MIN) return false;
+            out = -val;
+            return true;
+        }
+        if(std::holds_alternative<f64>(out)){
+            out = -std::get<f64>(out);
+            return true;
+        }
+        return false;
+    }
+
 
     void SliceExpr::emit(CodeEmitContext* ctx){
         if(start){
@@ -282,11 +364,34 @@ namespace pkpy{
         }
     }
 
+    void TupleExpr::emit(CodeEmitContext* ctx) {
+        PyObject* obj = fold(ctx);
+        if(obj != nullptr){
+            ctx->emit(OP_LOAD_CONST, ctx->add_const(obj), line);
+            return;
+        }
+        SequenceExpr::emit(ctx);
+    }
+
+    bool TupleExpr::is_foldable(CodeEmitContext* ctx) {
+        for(auto& item: items) if(!item->is_foldable(ctx)) return false;
+        return true;
+    }
+
+    PyObject* TupleExpr::fold(CodeEmitContext* ctx) {
+        VM* vm = ctx->vm;
+        // check first so that abandoned folding leaves no garbage behind
+        if(!is_foldable(ctx)) return nullptr;
+        Tuple tuple(items.size());
+        for(int i=0; i<(int)items.size(); i++) tuple[i] = items[i]->fold(ctx);
+        return VAR(std::move(tuple));
+    }
+
     bool TupleExpr::emit_store(CodeEmitContext* ctx) {
         // TOS is an iterable
         // items may contain StarredExpr, we should check it
         int starred_i = -1;
-        for(int i=0; i<items.size(); i++){
+        for(int i=0; i<(int)items.size(); i++){
             if(!items[i]->is_starred()) continue;
             if(starred_i == -1) starred_i = i;
             else return false;  // multiple StarredExpr not allowed
@@ -294,7 +399,7 @@ namespace pkpy{
 
         if(starred_i == -1){
             Bytecode& prev = ctx->co->codes.back();
-            if(prev.op == OP_BUILD_TUPLE && prev.arg == items.size()){
+            if(prev.op == OP_BUILD_TUPLE && prev.arg == (int)items.size()){
                 // build tuple and unpack it is meaningless
                 prev.op = OP_NO_OP;
                 prev.arg = BC_NOARG;
@@ -305,7 +410,7 @@ namespace pkpy{
             // starred assignment target must be in a tuple
             if(items.size() == 1) return false;
             // starred assignment target must be the last one (differ from cpython)
-            if(starred_i != items.size()-1) return false;
+            if(starred_i != (int)items.size()-1) return false;
             // a,*b = [1,2,3]
             // stack is [1,2,3] -> [1,[2,3]]
             ctx->emit(OP_UNPACK_EX, items.size()-1, line);
@@ -504,7 +609,7 @@ namespace pkpy{
             for(auto& item: args) item->emit(ctx);
             for(auto& item: kwargs){
                 int index = StrName(item.first.sv()).index;
-                ctx->emit(OP_LOAD_INTEGER, index, line);
+                ctx->emit(OP_LOAD_KWARG_NAME, index, line);
                 item.second->emit(ctx);
             }
             int KWARGC = (int)kwargs.size();
@@ -545,7 +650,68 @@ namespace pkpy{
         jmps.push_back(index);
     }
 
+    bool BinaryExpr::fold_value(CodeEmitContext* ctx, TokenValue& out) {
+        if(is_compare()) return false;
+        TokenValue _0, _1;
+        if(!lhs->fold_value(ctx, _0)) return false;
+        if(!rhs->fold_value(ctx, _1)) return false;
+        if(std::holds_alternative<i64>(_0) && std::holds_alternative<i64>(_1)){
+            i64 a = std::get<i64>(_0);
+            i64 b = std::get<i64>(_1);
+            switch(op){
+                case TK("&"): out = a & b; return true;
+                case TK("|"): out = a | b; return true;
+                case TK("^"): out = a ^ b; return true;
+                default: break;
+            }
+            // avoid overflow
+            const i64 kMax = 1 << 30;
+            if(a <= -kMax || a >= kMax || b <= -kMax || b >= kMax) return false;
+            switch(op){
+                case TK("+"): out = a + b; return true;
+                case TK("-"): out = a - b; return true;
+                case TK("*"): out = a * b; return true;
+                case TK("/"):
+                    if(b == 0) return false;
+                    out = a / (f64)b; return true;
+                // truncation and flooring agree on non-negative operands
+                case TK("//"):
+                    if(a < 0 || b <= 0) return false;
+                    out = a / b; return true;
+                case TK("%"):
+                    if(a < 0 || b <= 0) return false;
+                    out = a % b; return true;
+                default: return false;
+            }
+        }
+        bool is_num_0 = std::holds_alternative<i64>(_0) || std::holds_alternative<f64>(_0);
+        bool is_num_1 = std::holds_alternative<i64>(_1) || std::holds_alternative<f64>(_1);
+        if(is_num_0 && is_num_1){
+            f64 a = std::holds_alternative<f64>(_0) ? std::get<f64>(_0) : (f64)std::get<i64>(_0);
+            f64 b = std::holds_alternative<f64>(_1) ? std::get<f64>(_1) : (f64)std::get<i64>(_1);
+            switch(op){
+                case TK("+"): out = a + b; return true;
+                case TK("-"): out = a - b; return true;
+                case TK("*"): out = a * b; return true;
+                case TK("/"):
+                    if(b == 0) return false;
+                    out = a / b; return true;
+                default: return false;
+            }
+        }
+        if(op == TK("+") && std::holds_alternative<Str>(_0) && std::holds_alternative<Str>(_1)){
+            out = std::get<Str>(_0) + std::get<Str>(_1);
+            return true;
+        }
+        return false;
+    }
+
     void BinaryExpr::emit(CodeEmitContext* ctx) {
+        PyObject* obj = fold(ctx);
+        if(obj != nullptr){
+            ctx->emit_const(obj, line);
+            return;
+        }
         std::vector<int> jmps;
         if(is_compare() && lhs->is_compare()){
             // (a < b) < c
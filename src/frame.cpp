@@ -7,21 +7,6 @@ namespace pkpy{
         return &a[index];
     }
 
-    NameDict_ FastLocals::to_namedict(){
-        NameDict_ dict = std::make_shared<NameDict>();
-        varnames_inv->apply([&](StrName name, int index){
-            PyObject* value = a[index];
-            if(value != PY_NULL) dict->set(name, value);
-        });
-        return dict;
-    }
-
-    PyObject* Frame::f_closure_try_get(StrName name){
-        if(_callable == nullptr) return nullptr;
-        Function& fn = PK_OBJ_GET(Function, _callable);
-        if(fn._closure == nullptr) return nullptr;
-        return fn._closure->try_get(name);
-    }
 
     bool Frame::jump_to_exception_handler(){
         // try to find a parent try block
@@ -35,7 +20,7 @@ namespace pkpy{
         // get the stack size of the try block (depth of for loops)
         int _stack_size = co->blocks[block].for_loop_depth;
         if(stack_size() < _stack_size) throw std::runtime_error("invalid stack size");
-        _s->reset(actual_sp_base() + _locals.size() + _stack_size);          // rollback the stack   
+        _s->reset(_stack_base + _stack_size);      // rollback the stack
         _s->push(obj);                                      // push exception object
         _next_ip = co->blocks[block].end;
         return true;
@@ -50,7 +35,7 @@ namespace pkpy{
         const Bytecode& prev = co->codes[_ip];
         int i = prev.block;
         _next_ip = target;
-        if(_next_ip >= co->codes.size()){
+        if(_next_ip >= (int)co->codes.size()){
             while(i>=0) i = _exit_block(i);
         }else{
             // BUG (solved)
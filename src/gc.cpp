@@ -2,53 +2,240 @@
 
 namespace pkpy{
 
-    int ManagedHeap::sweep(){
-        std::vector<PyObject*> alive;
+    void ManagedHeap::_delete(PyObject* obj){
+#if PK_DEBUG_GC_STATS
+        deleted[obj->type] += 1;
+#endif
+        if(_gc_on_delete) _gc_on_delete(vm, obj);
+        _type_hooks[obj->type.index].destroy(obj);
+        pool64_dealloc(obj);
+    }
+
+    // promote marked young objects
+    int ManagedHeap::sweep_young(){
+        int freed = 0;
         for(PyObject* obj: gen){
             if(obj->gc.marked){
-                obj->gc.marked = false;
-                alive.push_back(obj);
+                old_gen.push_back(obj);
             }else{
-#if PK_DEBUG_GC_STATS
-                deleted[obj->type] += 1;
-#endif
-                if(_gc_on_delete) _gc_on_delete(vm, obj);
-                obj->~PyObject();
-                pool64_dealloc(obj);
+                _delete(obj);
+                freed++;
             }
         }
-
-        // clear _no_gc marked flag
-        for(PyObject* obj: _no_gc) obj->gc.marked = false;
-
-        int freed = gen.size() - alive.size();
-        // std::cout << "GC: " << alive.size() << "/" << gen.size() << " (" << freed << " freed)" << std::endl;
         gen.clear();
-        gen.swap(alive);
         return freed;
     }
 
+    int ManagedHeap::sweep(){
+        int j = 0;
+        for(PyObject* obj: old_gen){
+            if(obj->gc.marked) old_gen[j++] = obj;
+            else _delete(obj);
+        }
+        int freed = old_gen.size() - j;
+        old_gen.resize(j);
+        return freed + sweep_young();
+    }
+
     void ManagedHeap::_auto_collect(){
 #if !PK_DEBUG_NO_AUTO_GC
         if(_gc_lock_counter > 0) return;
+        if(incremental()){
+            if(gc_counter < step_interval) return;
+            gc_counter = 0;
+            if(phase == GC_IDLE && (int)(gen.size() + old_gen.size()) < old_threshold) return;
+            step(step_budget_us);
+            return;
+        }
         if(gc_counter < gc_threshold) return;
         gc_counter = 0;
+        if((int)old_gen.size() < old_threshold){
+            collect_young();
+            return;
+        }
         collect();
-        gc_threshold = gen.size() * 2;
-        if(gc_threshold < kMinGCThreshold) gc_threshold = kMinGCThreshold;
+        old_threshold = old_gen.size() * 2;
+        if(old_threshold < kMinOldThreshold) old_threshold = kMinOldThreshold;
 #endif
     }
 
+    static void update_pause(GCStats& stats, std::chrono::steady_clock::time_point t0){
+        auto t1 = std::chrono::steady_clock::now();
+        i64 us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        stats.pause_total_us += us;
+        if(us > stats.pause_max_us) stats.pause_max_us = us;
+    }
+
+    static void update_stats(GCStats& stats, int freed, std::chrono::steady_clock::time_point t0){
+        stats.collections++;
+        stats.collected += freed;
+        update_pause(stats, t0);
+    }
+
+    int ManagedHeap::collect_young(){
+        if(_gc_lock_counter > 0) FATAL_ERROR();
+        if(incremental()) return collect();
+        auto t0 = std::chrono::steady_clock::now();
+        mark_young();
+        int freed = sweep_young();
+        update_stats(stats[0], freed, t0);
+        return freed;
+    }
+
     int ManagedHeap::collect(){
         if(_gc_lock_counter > 0) FATAL_ERROR();
+        auto t0 = std::chrono::steady_clock::now();
+        _abort_cycle();
+        // a full collection traces everything, so reset the sticky bits
+        for(PyObject* obj: old_gen) obj->gc.marked = false;
+        for(PyObject* obj: gen) obj->gc.marked = false;
+        for(PyObject* obj: _no_gc) obj->gc.marked = false;
+        for(PyObject* obj: _remembered) obj->gc.remembered = false;
+        _remembered.clear();
         mark();
         int freed = sweep();
+        if(incremental()){
+            // the incremental mode starts every cycle with white objects
+            for(PyObject* obj: old_gen) obj->gc.marked = false;
+            for(PyObject* obj: _no_gc) obj->gc.marked = false;
+        }
+        update_stats(stats[1], freed, t0);
         return freed;
     }
 
+    void ManagedHeap::set_incremental(int budget_us){
+        if(budget_us < 0) budget_us = 0;
+        bool changed = incremental() != (budget_us > 0);
+        step_budget_us = budget_us;
+        // the two modes use the mark bits differently, a full collection brings them in line
+        if(changed) collect();
+    }
+
+    // returns true if a cycle is finished
+    bool ManagedHeap::step(int budget_us){
+        if(_gc_lock_counter > 0) FATAL_ERROR();
+        if(!incremental()){
+            collect();
+            return true;
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        auto deadline = t0 + std::chrono::microseconds(budget_us);
+        // `PK_OBJ_MARK` pushes to the thread-local stack, which may be shared by other heaps
+        _gray.swap(_gc_gray_objects);
+        if(phase == GC_IDLE) _start_cycle();
+        if(phase == GC_MARKING && _mark_step(deadline)) _finish_marking();
+        _gray.swap(_gc_gray_objects);
+        bool finished = false;
+        if(phase == GC_SWEEPING) finished = _sweep_step(deadline);
+        update_pause(stats[1], t0);
+        if(finished){
+            stats[1].collections++;
+            stats[1].collected += _cycle_freed;
+            _cycle_freed = 0;
+        }
+        return finished;
+    }
+
+    void ManagedHeap::_start_cycle(){
+        for(PyObject* obj: _remembered) obj->gc.remembered = false;
+        _remembered.clear();
+        for(PyObject* obj: _no_gc) PK_OBJ_MARK(obj);
+        _mark_roots();
+        _rescan_i = -1;
+        phase = GC_MARKING;
+    }
+
+    // returns true if there are no gray objects left
+    bool ManagedHeap::_mark_step(std::chrono::steady_clock::time_point deadline){
+        auto& gray = _gc_gray_objects;
+        int n = 0;
+        while(true){
+            PyObject* obj;
+            if(!gray.empty()){
+                obj = gray.back();
+                gray.pop_back();
+            }else if(!_remembered.empty()){
+                for(PyObject* p: _remembered){
+                    p->gc.remembered = false;
+                    gray.push_back(p);
+                }
+                _remembered.clear();
+                continue;
+            }else if(_rescan_i < 0){
+                // the remark is not budgeted, so the roots and `_no_gc` are rescanned here first
+                // and the remark only traces what is reachable from their changes since then
+                _rescan_i = 0;
+                _mark_roots();
+                continue;
+            }else if(_rescan_i < (int)_no_gc.size()){
+                obj = _no_gc[_rescan_i++];
+            }else{
+                return true;
+            }
+            _scan(obj);
+            if(++n % 64 == 0 && std::chrono::steady_clock::now() >= deadline) return false;
+        }
+    }
+
+    void ManagedHeap::_finish_marking(){
+        // roots and `_no_gc` are not guarded by write barriers, so scan them again
+        for(PyObject* obj: _remembered){
+            obj->gc.remembered = false;
+            _gc_gray_objects.push_back(obj);
+        }
+        _remembered.clear();
+        for(PyObject* obj: _no_gc) _scan(obj);
+        _mark_roots();
+        _propagate();
+        // objects allocated from now on are white and left to the next cycle
+        old_gen.insert(old_gen.end(), gen.begin(), gen.end());
+        gen.clear();
+        _sweep_i = _sweep_j = 0;
+        phase = GC_SWEEPING;
+    }
+
+    // returns true if the cycle is finished
+    bool ManagedHeap::_sweep_step(std::chrono::steady_clock::time_point deadline){
+        int size = old_gen.size();
+        while(_sweep_i < size){
+            PyObject* obj = old_gen[_sweep_i++];
+            if(obj->gc.marked){
+                obj->gc.marked = false;
+                old_gen[_sweep_j++] = obj;
+            }else{
+                _delete(obj);
+                _cycle_freed++;
+            }
+            if(_sweep_i % 256 == 0 && std::chrono::steady_clock::now() >= deadline) return false;
+        }
+        old_gen.resize(_sweep_j);
+        for(PyObject* obj: _no_gc) obj->gc.marked = false;
+        phase = GC_IDLE;
+        old_threshold = old_gen.size() * 2;
+        if(old_threshold < kMinOldThreshold) old_threshold = kMinOldThreshold;
+        return true;
+    }
+
+    void ManagedHeap::_abort_cycle(){
+        if(phase == GC_SWEEPING){
+            // close the gap between the swept and the unswept objects
+            auto it = std::copy(old_gen.begin() + _sweep_i, old_gen.end(), old_gen.begin() + _sweep_j);
+            old_gen.erase(it, old_gen.end());
+        }
+        _gray.clear();
+        _cycle_freed = 0;
+        phase = GC_IDLE;
+    }
+
     ManagedHeap::~ManagedHeap(){
-        for(PyObject* obj: _no_gc) { obj->~PyObject(); pool64_dealloc(obj); }
-        for(PyObject* obj: gen) { obj->~PyObject(); pool64_dealloc(obj); }
+        _abort_cycle();
+        auto destroy = [this](PyObject* obj){
+            _type_hooks[obj->type.index].destroy(obj);
+            pool64_dealloc(obj);
+        };
+        for(PyObject* obj: _no_gc) destroy(obj);
+        for(PyObject* obj: old_gen) destroy(obj);
+        for(PyObject* obj: gen) destroy(obj);
 #if PK_DEBUG_GC_STATS
         for(auto& [type, count]: deleted){
             std::cout << "GC: " << obj_type_name(vm, type) << "=" << count << std::endl;
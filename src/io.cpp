@@ -22,6 +22,23 @@ static size_t io_fread(void* buffer, size_t size, size_t count, FILE* fp){
 #endif
 }
 
+// 64-bit offsets, so files larger than 2GB work on Windows too
+static int io_fseek(FILE* fp, i64 offset, int whence){
+#if _MSC_VER
+    return _fseeki64(fp, offset, whence);
+#else
+    return fseeko(fp, offset, whence);
+#endif
+}
+
+static i64 io_ftell(FILE* fp){
+#if _MSC_VER
+    return _ftelli64(fp);
+#else
+    return ftello(fp);
+#endif
+}
+
 
 Bytes _default_import_handler(const Str& name){
 #if PK_ENABLE_OS
@@ -46,6 +63,61 @@ Bytes _default_import_handler(const Str& name){
 
 
 #if PK_ENABLE_OS
+// `a/b.py` is cached in `a/__pycache__/b.pkc`
+static std::filesystem::path bytecode_cache_path(const Str& name){
+    std::filesystem::path path(name.sv());
+    return path.parent_path() / "__pycache__" / path.stem().concat(".pkc");
+}
+#endif
+
+Bytes _default_bytecode_cache_loader(const Str& name){
+#if PK_ENABLE_OS
+    std::filesystem::path path = bytecode_cache_path(name);
+    std::error_code ec;
+    if(!std::filesystem::exists(path, ec)) return Bytes();
+    return _default_import_handler(Str(path.string()));
+#else
+    return Bytes();
+#endif
+}
+
+void _default_bytecode_cache_writer(const Str& name, const Bytes& data){
+#if PK_ENABLE_OS
+    std::filesystem::path path = bytecode_cache_path(name);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if(ec) return;      // the cache is optional
+    // write to a temporary file first, so other processes never read a partial cache
+    std::filesystem::path tmp = path;
+    tmp += ".tmp";
+    FILE* fp = io_fopen(tmp.string().c_str(), "wb");
+    if(!fp) return;
+    size_t sz = fwrite(data.data(), 1, data.size(), fp);
+    fclose(fp);
+    if(sz == (size_t)data.size()) std::filesystem::rename(tmp, path, ec);
+    if(sz != (size_t)data.size() || ec) std::filesystem::remove(tmp, ec);
+#endif
+}
+
+#if PK_ENABLE_OS
+    static FileIO& _check_open(VM* vm, PyObject* obj){
+        FileIO& io = CAST(FileIO&, obj);
+        if(io.fp == nullptr) vm->ValueError("I/O operation on closed file");
+        return io;
+    }
+
+    static FileIO& _check_readable(VM* vm, PyObject* obj){
+        FileIO& io = _check_open(vm, obj);
+        if(!io.is_readable()) vm->IOError("file not open for reading");
+        if(!io.flush()) vm->IOError(strerror(errno));
+        return io;
+    }
+
+    static PyObject* _wrap(VM* vm, const FileIO& io, std::string&& s){
+        if(io.is_text()) return VAR(std::move(s));
+        return VAR(Bytes(std::string_view(s)));
+    }
+
     void FileIO::_register(VM* vm, PyObject* mod, PyObject* type){
         vm->bind_constructor<3>(type, [](VM* vm, ArgsView args){
             return VAR_T(FileIO, 
@@ -53,32 +125,78 @@ Bytes _default_import_handler(const Str& name){
             );
         });
 
-        vm->bind_method<0>(type, "read", [](VM* vm, ArgsView args){
-            FileIO& io = CAST(FileIO&, args[0]);
-            fseek(io.fp, 0, SEEK_END);
-            int buffer_size = ftell(io.fp);
-            unsigned char* buffer = new unsigned char[buffer_size];
-            fseek(io.fp, 0, SEEK_SET);
-            size_t actual_size = io_fread(buffer, 1, buffer_size, io.fp);
-            PK_ASSERT(actual_size <= buffer_size);
-            // in text mode, CR may be dropped, which may cause `actual_size < buffer_size`
-            Bytes b(buffer, actual_size);
-            if(io.is_text()) return VAR(b.str());
-            return VAR(std::move(b));
+        vm->bind(type, "read(self, size=-1)", [](VM* vm, ArgsView args){
+            FileIO& io = _check_readable(vm, args[0]);
+            return _wrap(vm, io, io.read(CAST(i64, args[1])));
+        });
+
+        vm->bind_method<0>(type, "readline", [](VM* vm, ArgsView args){
+            FileIO& io = _check_readable(vm, args[0]);
+            return _wrap(vm, io, io.readline());
+        });
+
+        vm->bind_method<0>(type, "readlines", [](VM* vm, ArgsView args){
+            FileIO& io = _check_readable(vm, args[0]);
+            List lines;
+            while(true){
+                std::string line = io.readline();
+                if(line.empty()) break;
+                lines.push_back(_wrap(vm, io, std::move(line)));
+            }
+            return VAR(std::move(lines));
+        });
+
+        // lines are read one by one, the file is never loaded as a whole
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            _check_readable(vm, obj);
+            return obj;
+        });
+
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            FileIO& io = _check_readable(vm, obj);
+            std::string line = io.readline();
+            if(line.empty()) return vm->StopIteration;
+            return _wrap(vm, io, std::move(line));
         });
 
         vm->bind_method<1>(type, "write", [](VM* vm, ArgsView args){
-            FileIO& io = CAST(FileIO&, args[0]);
+            FileIO& io = _check_open(vm, args[0]);
+            if(!io.is_writable()) vm->IOError("file not open for writing");
             if(io.is_text()){
                 Str& s = CAST(Str&, args[1]);
-                fwrite(s.data, 1, s.length(), io.fp);
-            }else{
-                Bytes& buffer = CAST(Bytes&, args[1]);
-                fwrite(buffer.data(), 1, buffer.size(), io.fp);
+                io.write(s.sv());
+                return VAR(s.u8_length());
             }
+            Bytes& buffer = CAST(Bytes&, args[1]);
+            io.write(buffer.sv());
+            return VAR(buffer.size());
+        });
+
+        vm->bind_method<0>(type, "flush", [](VM* vm, ArgsView args){
+            FileIO& io = _check_open(vm, args[0]);
+            if(!io.flush()) vm->IOError(strerror(errno));
             return vm->None;
         });
 
+        vm->bind_method<0>(type, "tell", [](VM* vm, ArgsView args){
+            FileIO& io = _check_open(vm, args[0]);
+            return VAR(io.tell());
+        });
+
+        vm->bind(type, "seek(self, offset, whence=0)", [](VM* vm, ArgsView args){
+            FileIO& io = _check_open(vm, args[0]);
+            i64 offset = CAST(i64, args[1]);
+            int whence = CAST(int, args[2]);
+            if(whence < 0 || whence > 2) vm->ValueError("invalid whence");
+            i64 pos = io.seek(offset, whence);
+            if(pos < 0) vm->IOError(strerror(errno));
+            return VAR(pos);
+        });
+
+        vm->bind_property(type, "closed", [](VM* vm, ArgsView args){
+            return VAR(CAST(FileIO&, args[0]).fp == nullptr);
+        });
+
         vm->bind_method<0>(type, "close", [](VM* vm, ArgsView args){
             FileIO& io = CAST(FileIO&, args[0]);
             io.close();
@@ -99,10 +217,111 @@ Bytes _default_import_handler(const Str& name){
         if(!fp) vm->IOError(strerror(errno));
     }
 
+    // moves the unconsumed bytes to the front and reads more after them
+    bool FileIO::_fill(){
+        if(_rpos > 0){
+            _rbuf.erase(0, _rpos);
+            _rpos = 0;
+        }
+        size_t size = _rbuf.size();
+        _rbuf.resize(size + kBufferSize);
+        size_t n = io_fread(_rbuf.data() + size, 1, kBufferSize, fp);
+        _rbuf.resize(size + n);
+        return n > 0;
+    }
+
+    // the position of `fp` is moved back to where the reader is
+    void FileIO::_drop_read_ahead(){
+        int unconsumed = _rbuf.size() - _rpos;
+        if(unconsumed > 0) io_fseek(fp, -unconsumed, SEEK_CUR);
+        _rbuf.clear();
+        _rpos = 0;
+    }
+
+    // `size` counts chars in text mode, a char is never split
+    std::string FileIO::read(i64 size){
+        std::string out;
+        if(size < 0){
+            out.append(_rbuf, _rpos);
+            _rbuf.clear();
+            _rpos = 0;
+            while(_fill()){
+                out += _rbuf;
+                _rbuf.clear();
+            }
+            return out;
+        }
+        if(!is_text()){
+            while((i64)out.size() < size){
+                if(_rpos == (int)_rbuf.size() && !_fill()) break;
+                int n = std::min<i64>(_rbuf.size() - _rpos, size - out.size());
+                out.append(_rbuf, _rpos, n);
+                _rpos += n;
+            }
+            return out;
+        }
+        for(i64 i=0; i<size; i++){
+            if(_rpos == (int)_rbuf.size() && !_fill()) break;
+            int n = std::max(utf8len(_rbuf[_rpos], true), 1);
+            while(_rpos + n > (int)_rbuf.size() && _fill());
+            n = std::min<int>(n, _rbuf.size() - _rpos);
+            out.append(_rbuf, _rpos, n);
+            _rpos += n;
+        }
+        return out;
+    }
+
+    // the line keeps its `\n`, an empty string means the end of the file
+    std::string FileIO::readline(){
+        std::string line;
+        while(true){
+            if(_rpos == (int)_rbuf.size() && !_fill()) break;
+            const char* begin = _rbuf.data() + _rpos;
+            int size = _rbuf.size() - _rpos;
+            const char* p = (const char*)memchr(begin, '\n', size);
+            int n = p ? p - begin + 1 : size;
+            line.append(begin, n);
+            _rpos += n;
+            if(p) break;
+        }
+        return line;
+    }
+
+    void FileIO::write(std::string_view s){
+        _drop_read_ahead();
+        _wbuf.append(s);
+        if(_wbuf.size() >= kBufferSize) flush();
+    }
+
+    bool FileIO::flush(){
+        if(_wbuf.empty()) return true;
+        size_t n = fwrite(_wbuf.data(), 1, _wbuf.size(), fp);
+        bool ok = n == _wbuf.size();
+        _wbuf.clear();
+        return ok && fflush(fp) == 0;
+    }
+
+    i64 FileIO::tell(){
+        return io_ftell(fp) - (i64)(_rbuf.size() - _rpos) + (i64)_wbuf.size();
+    }
+
+    i64 FileIO::seek(i64 offset, int whence){
+        if(whence == SEEK_CUR) offset -= _rbuf.size() - _rpos;
+        flush();
+        _rbuf.clear();
+        _rpos = 0;
+        if(io_fseek(fp, offset, whence) != 0) return -1;
+        return io_ftell(fp);
+    }
+
     void FileIO::close(){
         if(fp == nullptr) return;
+        flush();
         fclose(fp);
         fp = nullptr;
+        _rbuf.clear();
+        _rbuf.shrink_to_fit();
+        _rpos = 0;
     }
 
 #endif
@@ -40,15 +40,133 @@ namespace pkpy{
         });
     }
 
-    PyObject* Generator::next(VM* vm){
-        if(state == 2) return vm->StopIteration;
-        // reset frame._sp_base
-        frame._sp_base = frame._s->_sp;
-        frame._locals.a = frame._s->_sp;
-        // restore the context
+    void MapIter::_register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind_constructor<3>(type, [](VM* vm, ArgsView args){
+            return VAR_T(MapIter, args[1], vm->py_iter(args[2]));
+        });
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            MapIter& self = _CAST(MapIter&, obj);
+            PyObject* item = vm->py_next(self.it);
+            if(item == vm->StopIteration) return item;
+            return vm->call(self.f, item);
+        });
+    }
+
+    void FilterIter::_register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind_constructor<3>(type, [](VM* vm, ArgsView args){
+            return VAR_T(FilterIter, args[1], vm->py_iter(args[2]));
+        });
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            FilterIter& self = _CAST(FilterIter&, obj);
+            while(true){
+                PyObject* item = vm->py_next(self.it);
+                if(item == vm->StopIteration) return item;
+                // keep `item` on the stack while its result is tested
+                vm->s_data.push(item);
+                bool ok = vm->py_bool(self.f == vm->None ? item : vm->call(self.f, item));
+                vm->s_data.pop();
+                if(ok) return item;
+            }
+        });
+    }
+
+    void ZipIter::_register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind(type, "__new__(cls, *iterables)", [](VM* vm, ArgsView args){
+            const Tuple& iterables = CAST(Tuple&, args[1]);
+            // the iterators are kept on the stack until the zip object owns them
+            for(int i=0; i<iterables.size(); i++) vm->s_data.push(vm->py_iter(iterables[i]));
+            List its = vm->s_data.view(iterables.size()).to_list();
+            vm->s_data.shrink(iterables.size());
+            return VAR_T(ZipIter, std::move(its));
+        });
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            ZipIter& self = _CAST(ZipIter&, obj);
+            int n = self.its.size();
+            if(n == 0) return vm->StopIteration;
+            // the items are kept on the stack until the tuple is created
+            for(int i=0; i<n; i++){
+                PyObject* item = vm->py_next(self.its[i]);
+                if(item == vm->StopIteration){
+                    vm->s_data.shrink(i);
+                    return vm->StopIteration;
+                }
+                vm->s_data.push(item);
+            }
+            Tuple t = vm->s_data.view(n).to_tuple();
+            vm->s_data.shrink(n);
+            return VAR(std::move(t));
+        });
+    }
+
+    void EnumerateIter::_register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind(type, "__new__(cls, iterable, start=0)", [](VM* vm, ArgsView args){
+            return VAR_T(EnumerateIter, vm->py_iter(args[1]), CAST(i64, args[2]));
+        });
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            EnumerateIter& self = _CAST(EnumerateIter&, obj);
+            PyObject* item = vm->py_next(self.it);
+            if(item == vm->StopIteration) return item;
+            return VAR(Tuple({VAR(self.index++), item}));
+        });
+    }
+
+    void ReversedIter::_register(VM* vm, PyObject* mod, PyObject* type){
+        vm->_all_types[PK_OBJ_GET(Type, type)].subclass_enabled = false;
+        vm->bind_constructor<2>(type, [](VM* vm, ArgsView args){
+            PyObject* ref = args[1];
+            // other iterables are copied into a list first
+            if(!is_non_tagged_type(ref, vm->tp_list) && !is_non_tagged_type(ref, vm->tp_tuple)){
+                ref = vm->py_list(ref);
+            }
+            i64 size = is_non_tagged_type(ref, vm->tp_list) ? PK_OBJ_GET(List, ref).size() : PK_OBJ_GET(Tuple, ref).size();
+            return VAR_T(ReversedIter, ref, size - 1);
+        });
+        vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
+        vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
+            ReversedIter& self = _CAST(ReversedIter&, obj);
+            if(self.index < 0) return vm->StopIteration;
+            // the list may shrink during the iteration
+            if(is_non_tagged_type(self.ref, vm->tp_list)){
+                const List& list = PK_OBJ_GET(List, self.ref);
+                if(self.index < list.size()) return list[self.index--];
+            }else{
+                const Tuple& tuple = PK_OBJ_GET(Tuple, self.ref);
+                if(self.index < tuple.size()) return tuple[self.index--];
+            }
+            self.index = -1;
+            return vm->StopIteration;
+        });
+    }
+
+    void Generator::_resume(VM* vm){
+        // the locals are not moved, only the operand stack is restored
+        frame._sp_base = frame._stack_base = frame._s->_sp;
         for(PyObject* obj: s_backup) frame._s->push(obj);
         s_backup.clear();
         vm->callstack.push(std::move(frame));
+    }
+
+    PyObject* Generator::_suspend(VM* vm){
+        frame = std::move(vm->callstack.top());
+        PyObject* ret = frame._s->popx();
+        for(PyObject* obj: frame.stack_view()) s_backup.push_back(obj);
+        vm->_pop_frame();
+        state = 1;
+        if(ret == vm->StopIteration) state = 2;
+        return ret;
+    }
+
+    PyObject* Generator::next(VM* vm){
+        if(state == 2) return vm->StopIteration;
+        _resume(vm);
 
         PyObject* ret;
         try{
@@ -58,19 +176,9 @@ namespace pkpy{
             throw;
         }
         
-        if(ret == PY_OP_YIELD){
-            // backup the context
-            frame = std::move(vm->callstack.top());
-            ret = frame._s->popx();
-            for(PyObject* obj: frame.stack_view()) s_backup.push_back(obj);
-            vm->_pop_frame();
-            state = 1;
-            if(ret == vm->StopIteration) state = 2;
-            return ret;
-        }else{
-            state = 2;
-            return vm->StopIteration;
-        }
+        if(ret == PY_OP_YIELD) return _suspend(vm);
+        state = 2;
+        return vm->StopIteration;
     }
 
     void Generator::_register(VM* vm, PyObject* mod, PyObject* type){
@@ -79,7 +187,9 @@ namespace pkpy{
         vm->bind__iter__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){ return obj; });
         vm->bind__next__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj){
             Generator& self = _CAST(Generator&, obj);
-            return self.next(vm);
+            PyObject* ret = self.next(vm);
+            vm->heap.write_barrier(obj);    // the stack is saved into `self`
+            return ret;
         });
     }
 
@@ -0,0 +1,476 @@
+#include "pocketpy/json.h"
+
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PK_JSON_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define PK_JSON_NEON 1
+#endif
+
+namespace pkpy{
+
+static bool is_json_ws(char c){
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// a byte that ends the plain run of a string: '"', '\\' or a control character
+static bool is_json_special(char c){
+    return c == '"' || c == '\\' || (unsigned char)c < 0x20;
+}
+
+#if PK_JSON_SSE2
+static int ctz16(unsigned mask){
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, mask);
+    return (int)i;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+static const char* skip_ws(const char* p, const char* end){
+    if(p < end && !is_json_ws(*p)) return p;
+#if PK_JSON_SSE2
+    while(end - p >= 16){
+        __m128i v = _mm_loadu_si128((const __m128i*)p);
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')))
+        );
+        unsigned mask = ~(unsigned)_mm_movemask_epi8(ws) & 0xFFFF;
+        if(mask != 0) return p + ctz16(mask);
+        p += 16;
+    }
+#endif
+    while(p < end && is_json_ws(*p)) p++;
+    return p;
+}
+
+// returns the first special byte in [p, end), or `end`
+static const char* scan_plain(const char* p, const char* end){
+#if PK_JSON_SSE2
+    while(end - p >= 16){
+        __m128i v = _mm_loadu_si128((const __m128i*)p);
+        __m128i ctrl = _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(0x1F)), _mm_set1_epi8(0x1F));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+            ctrl
+        );
+        unsigned mask = (unsigned)_mm_movemask_epi8(m);
+        if(mask != 0) return p + ctz16(mask);
+        p += 16;
+    }
+#elif PK_JSON_NEON
+    while(end - p >= 16){
+        uint8x16_t v = vld1q_u8((const uint8_t*)p);
+        uint8x16_t m = vorrq_u8(
+            vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\'))),
+            vcltq_u8(v, vdupq_n_u8(0x20))
+        );
+        if(vmaxvq_u8(m) != 0) break;
+        p += 16;
+    }
+#endif
+    while(p < end && !is_json_special(*p)) p++;
+    return p;
+}
+
+static void utf8_append(std::string& out, uint32_t cp){
+    if(cp < 0x80){
+        out.push_back((char)cp);
+    }else if(cp < 0x800){
+        out.push_back((char)(0xC0 | (cp >> 6)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }else if(cp < 0x10000){
+        out.push_back((char)(0xE0 | (cp >> 12)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }else{
+        out.push_back((char)(0xF0 | (cp >> 18)));
+        out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+// A single-pass reader which builds the objects directly
+struct JsonReader{
+    static constexpr int kMaxDepth = 1000;
+
+    VM* vm;
+    const char* begin;
+    const char* p;
+    const char* end;
+    int depth = 0;
+    std::string buf;    // scratch space for strings with escapes
+    // dict keys without escapes are shared, most documents repeat them a lot
+    std::unordered_map<std::string_view, PyObject*> keys;
+
+    JsonReader(VM* vm, std::string_view s): vm(vm), begin(s.data()), p(s.data()), end(s.data() + s.size()) {}
+
+    void error(const char* msg, const char* pos){
+        int line = 1;
+        const char* line_start = begin;
+        for(const char* q=begin; q<pos; q++){
+            if(*q == '\n'){ line++; line_start = q + 1; }
+        }
+        vm->ValueError(fmt(msg, ": line ", line, " column ", (int)(pos - line_start) + 1, " (char ", (int)(pos - begin), ")"));
+    }
+
+    PyObject* parse(){
+        p = skip_ws(p, end);
+        PyObject* obj = parse_value();
+        p = skip_ws(p, end);
+        if(p != end) error("Extra data", p);
+        return obj;
+    }
+
+    bool eat_literal(const char* lit, int n){
+        if(end - p < n || memcmp(p, lit, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    PyObject* parse_value(){
+        if(p == end) error("Expecting value", p);
+        switch(*p){
+            case '{': return parse_object();
+            case '[': return parse_array();
+            case '"': return VAR(parse_string());
+            case 't': if(eat_literal("true", 4)) return vm->True; break;
+            case 'f': if(eat_literal("false", 5)) return vm->False; break;
+            case 'n': if(eat_literal("null", 4)) return vm->None; break;
+            default:
+                if(*p == '-' || (*p >= '0' && *p <= '9')) return parse_number();
+                break;
+        }
+        error("Expecting value", p);
+        return nullptr;
+    }
+
+    void _enter(){
+        if(++depth > kMaxDepth) error("Nesting is too deep", p);
+    }
+
+    PyObject* parse_array(){
+        _enter();
+        p++;    // '['
+        List list;
+        p = skip_ws(p, end);
+        if(p < end && *p == ']'){
+            p++;
+            depth--;
+            return VAR(std::move(list));
+        }
+        while(true){
+            p = skip_ws(p, end);
+            list.push_back(parse_value());
+            p = skip_ws(p, end);
+            if(p < end && *p == ','){ p++; continue; }
+            if(p < end && *p == ']'){ p++; break; }
+            error("Expecting ',' delimiter", p);
+        }
+        depth--;
+        return VAR(std::move(list));
+    }
+
+    PyObject* parse_key(){
+        if(p == end || *p != '"') error("Expecting property name enclosed in double quotes", p);
+        const char* start = p + 1;
+        const char* q = scan_plain(start, end);
+        if(q < end && *q == '"'){
+            std::string_view sv(start, q - start);
+            p = q + 1;
+            auto it = keys.find(sv);
+            if(it != keys.end()) return it->second;
+            PyObject* key = VAR(Str(sv));
+            keys[sv] = key;
+            return key;
+        }
+        return VAR(parse_string());
+    }
+
+    PyObject* parse_object(){
+        _enter();
+        p++;    // '{'
+        Dict dict(vm);
+        p = skip_ws(p, end);
+        if(p < end && *p == '}'){
+            p++;
+            depth--;
+            return VAR(std::move(dict));
+        }
+        while(true){
+            p = skip_ws(p, end);
+            PyObject* key = parse_key();
+            p = skip_ws(p, end);
+            if(p == end || *p != ':') error("Expecting ':' delimiter", p);
+            p = skip_ws(p + 1, end);
+            dict.set(key, parse_value());
+            p = skip_ws(p, end);
+            if(p < end && *p == ','){ p++; continue; }
+            if(p < end && *p == '}'){ p++; break; }
+            error("Expecting ',' delimiter", p);
+        }
+        depth--;
+        return VAR(std::move(dict));
+    }
+
+    uint32_t parse_hex4(){
+        if(end - p < 4) error("Invalid \\uXXXX escape", p);
+        uint32_t cp = 0;
+        for(int i=0; i<4; i++){
+            char c = p[i];
+            cp <<= 4;
+            if(c >= '0' && c <= '9') cp |= c - '0';
+            else if(c >= 'a' && c <= 'f') cp |= c - 'a' + 10;
+            else if(c >= 'A' && c <= 'F') cp |= c - 'A' + 10;
+            else error("Invalid \\uXXXX escape", p);
+        }
+        p += 4;
+        return cp;
+    }
+
+    Str parse_string(){
+        const char* start = ++p;    // '"'
+        const char* q = scan_plain(p, end);
+        if(q < end && *q == '"'){
+            p = q + 1;
+            return Str(start, q - start);
+        }
+        buf.clear();
+        while(true){
+            buf.append(p, q - p);
+            p = q;
+            if(p == end) error("Unterminated string starting at", start - 1);
+            char c = *p++;
+            if(c == '"') break;
+            if(c != '\\') error("Invalid control character at", p - 1);
+            if(p == end) error("Unterminated string starting at", start - 1);
+            switch(*p++){
+                case '"': buf.push_back('"'); break;
+                case '\\': buf.push_back('\\'); break;
+                case '/': buf.push_back('/'); break;
+                case 'b': buf.push_back('\b'); break;
+                case 'f': buf.push_back('\f'); break;
+                case 'n': buf.push_back('\n'); break;
+                case 'r': buf.push_back('\r'); break;
+                case 't': buf.push_back('\t'); break;
+                case 'u': {
+                    uint32_t cp = parse_hex4();
+                    // a surrogate pair encodes one code point beyond the BMP
+                    if(cp >= 0xD800 && cp <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u'){
+                        const char* saved = p;
+                        p += 2;
+                        uint32_t lo = parse_hex4();
+                        if(lo >= 0xDC00 && lo <= 0xDFFF){
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        }else{
+                            p = saved;
+                        }
+                    }
+                    utf8_append(buf, cp);
+                    break;
+                }
+                default: error("Invalid \\escape", p - 2);
+            }
+            q = scan_plain(p, end);
+        }
+        return Str(buf);
+    }
+
+    PyObject* parse_number(){
+        const char* start = p;
+        if(*p == '-') p++;
+        if(p == end || !(*p >= '0' && *p <= '9')) error("Expecting value", start);
+        if(*p == '0') p++;
+        else while(p < end && *p >= '0' && *p <= '9') p++;
+        bool is_float = false;
+        if(p < end && *p == '.'){
+            is_float = true;
+            p++;
+            if(p == end || !(*p >= '0' && *p <= '9')) error("Expecting digits after '.'", p);
+            while(p < end && *p >= '0' && *p <= '9') p++;
+        }
+        if(p < end && (*p == 'e' || *p == 'E')){
+            is_float = true;
+            p++;
+            if(p < end && (*p == '+' || *p == '-')) p++;
+            if(p == end || !(*p >= '0' && *p <= '9')) error("Expecting digits in exponent", p);
+            while(p < end && *p >= '0' && *p <= '9') p++;
+        }
+        if(is_float){
+            // strtod needs a terminated string
+            char small[64];
+            int n = p - start;
+            if(n < (int)sizeof(small)){
+                memcpy(small, start, n);
+                small[n] = '\0';
+                return VAR(std::strtod(small, nullptr));
+            }
+            return VAR(std::strtod(std::string(start, n).c_str(), nullptr));
+        }
+        bool neg = *start == '-';
+        i64 val = 0;
+        for(const char* q=start+neg; q<p; q++){
+            int digit = *q - '0';
+            if(i64_mul_overflow(val, 10, &val) || i64_add_overflow(val, neg ? -digit : digit, &val)){
+                BigInt big;
+                BigInt::from_str(std::string_view(start, p - start), big);
+                return VAR(std::move(big));
+            }
+        }
+        return VAR(val);
+    }
+};
+
+PyObject* json_loads(VM* vm, std::string_view s){
+    // the objects are unreachable until the whole document is built
+    auto _lock = vm->heap.gc_scope_lock();
+    JsonReader reader(vm, s);
+    return reader.parse();
+}
+
+void JsonWriter::_enter(PyObject* obj){
+    for(PyObject* other: _path){
+        if(other == obj) vm->ValueError("circular reference detected");
+    }
+    if(_path.size() >= kMaxDepth) vm->StackOverflowError();
+    _path.push_back(obj);
+}
+
+void JsonWriter::write(PyObject* obj){
+    if(is_small_int(obj)){
+        char tmp[24];
+        int n = snprintf(tmp, sizeof(tmp), "%lld", (long long)(PK_BITS(obj) >> 2));
+        buf.append(tmp, n);
+        return;
+    }
+    if(is_float(obj)){
+        write_float(untag_float(obj));
+        return;
+    }
+    if(obj == vm->None){ buf.append("null"); return; }
+    if(obj == vm->True){ buf.append("true"); return; }
+    if(obj == vm->False){ buf.append("false"); return; }
+    Type t = vm->_tp(obj);
+    if(t == vm->tp_str){ write_str(PK_OBJ_GET(Str, obj)); return; }
+    if(t == vm->tp_list){ write_list(obj); return; }
+    if(t == vm->tp_dict){ write_dict(obj); return; }
+    if(t == vm->tp_tuple){ write_tuple(obj); return; }
+    if(t == vm->tp_int){ buf.append(std::to_string(PK_OBJ_GET(i64, obj))); return; }
+    if(t == vm->tp_long){ buf.append(PK_OBJ_GET(BigInt, obj).to_string()); return; }
+    const Str& s = CAST(Str&, vm->py_json(obj));
+    buf.append(s.data, s.size);
+}
+
+void JsonWriter::write_str(const Str& s){
+    static const char* kHex = "0123456789abcdef";
+    const char* p = s.data;
+    const char* end = s.data + s.size;
+    buf.push_back('"');
+    while(true){
+        const char* q = scan_plain(p, end);
+        buf.append(p, q - p);
+        if(q == end) break;
+        char c = *q;
+        switch(c){
+            case '"': buf.append("\\\""); break;
+            case '\\': buf.append("\\\\"); break;
+            case '\n': buf.append("\\n"); break;
+            case '\r': buf.append("\\r"); break;
+            case '\t': buf.append("\\t"); break;
+            case '\b': buf.append("\\b"); break;
+            case '\f': buf.append("\\f"); break;
+            default:
+                buf.append("\\u00");
+                buf.push_back(kHex[(c >> 4) & 0xF]);
+                buf.push_back(kHex[c & 0xF]);
+                break;
+        }
+        p = q + 1;
+    }
+    buf.push_back('"');
+}
+
+void JsonWriter::write_float(f64 val){
+    if(std::isinf(val) || std::isnan(val)) vm->ValueError("cannot jsonify 'nan' or 'inf'");
+    // the same digits as `float.__repr__`
+    char tmp[32];
+    int n = snprintf(tmp, sizeof(tmp), "%.*g", std::numeric_limits<f64>::max_digits10-1, val);
+    bool is_integral = true;
+    for(int i=0; i<n; i++){
+        if(tmp[i] != '-' && !(tmp[i] >= '0' && tmp[i] <= '9')){ is_integral = false; break; }
+    }
+    buf.append(tmp, n);
+    if(is_integral) buf.append(".0");
+}
+
+// `__json__` of the items may change the list, so it is re-read each time
+void JsonWriter::write_list(PyObject* obj){
+    _enter(obj);
+    const List& list = PK_OBJ_GET(List, obj);
+    buf.push_back('[');
+    for(int i=0; i<list.size(); i++){
+        if(i > 0) buf.append(", ");
+        write(list[i]);
+    }
+    buf.push_back(']');
+    _path.pop_back();
+}
+
+void JsonWriter::write_tuple(PyObject* obj){
+    _enter(obj);
+    const Tuple& tuple = PK_OBJ_GET(Tuple, obj);
+    buf.push_back('[');
+    for(int i=0; i<tuple.size(); i++){
+        if(i > 0) buf.append(", ");
+        write(tuple[i]);
+    }
+    buf.push_back(']');
+    _path.pop_back();
+}
+
+void JsonWriter::write_dict(PyObject* obj){
+    _enter(obj);
+    const Dict& dict = PK_OBJ_GET(Dict, obj);
+    buf.push_back('{');
+    bool first = true;
+    dict.apply([&](PyObject* k, PyObject* v){
+        if(!first) buf.append(", ");
+        first = false;
+        write_str(CAST(Str&, k));
+        buf.append(": ");
+        write(v);
+    });
+    buf.push_back('}');
+    _path.pop_back();
+}
+
+Str json_dumps(VM* vm, PyObject* obj){
+    JsonWriter writer(vm);
+    writer.write(obj);
+    return writer.str();
+}
+
+void add_module_json(VM* vm){
+    PyObject* mod = vm->new_module("json");
+    vm->bind_func<1>(mod, "loads", [](VM* vm, ArgsView args) {
+        if(is_non_tagged_type(args[0], vm->tp_bytes)){
+            const Bytes& b = PK_OBJ_GET(Bytes, args[0]);
+            return json_loads(vm, b.sv());
+        }
+        return json_loads(vm, CAST(Str&, args[0]).sv());
+    });
+
+    vm->bind_func<1>(mod, "dumps", [](VM* vm, ArgsView args) {
+        return VAR(json_dumps(vm, args[0]));
+    });
+}
+
+}   // namespace pkpy
@@ -100,7 +100,7 @@ static bool is_unicode_Lo_char(uint32_t c) {
             }
             // handle multibyte char
             std::string u8str(curr_char, u8bytes);
-            if(u8str.size() != u8bytes) return 2;
+            if((int)u8str.size() != u8bytes) return 2;
             uint32_t value = 0;
             for(int k=0; k < u8bytes; k++){
                 uint8_t b = u8str[k];
@@ -292,6 +292,13 @@ static bool is_unicode_Lo_char(uint32_t c) {
                 add_token(TK("@num"), (i64)std::stoll(m[0], &size, base));
             }
             PK_ASSERT((int)size == (int)m.length());
+        }catch(std::out_of_range&){
+            // a decimal integer out of the range of i64 is a `long`
+            if(!m[1].matched && !m[2].matched){
+                add_token(TK("@long"));
+                return;
+            }
+            SyntaxError("invalid number literal");
         }catch(...){
             SyntaxError("invalid number literal");
         }
@@ -136,7 +136,7 @@ struct MemoryPool{
         bool dirty;
         
         Arena(): _free_list_size(__MaxBlocks), dirty(false){
-            for(int i=0; i<__MaxBlocks; i++){
+            for(int i=0; i<(int)__MaxBlocks; i++){
                 _blocks[i].arena = this;
                 _free_list[i] = &_blocks[i];
             }
@@ -2,16 +2,16 @@
 
 namespace pkpy{
 
-uint16_t _find_perfect_hash_seed(uint16_t capacity, const std::vector<StrName>& keys){
+uint32_t _find_perfect_hash_seed(uint32_t capacity, const std::vector<StrName>& keys){
     if(keys.empty()) return kHashSeeds[0];
-    static std::set<uint16_t> indices;
+    static std::set<uint32_t> indices;
     indices.clear();
-    std::pair<uint16_t, float> best_score = {kHashSeeds[0], 0.0f};
+    std::pair<uint32_t, float> best_score = {kHashSeeds[0], 0.0f};
     const int kHashSeedsSize = sizeof(kHashSeeds) / sizeof(kHashSeeds[0]);
     for(int i=0; i<kHashSeedsSize; i++){
         indices.clear();
         for(auto key: keys){
-            uint16_t index = _hash(key, capacity-1, kHashSeeds[i]);
+            uint32_t index = _hash(key, capacity-1, kHashSeeds[i]);
             indices.insert(index);
         }
         float score = indices.size() / (float)keys.size();
@@ -73,11 +73,289 @@ static dylib_entry_t load_dylib(const char* path){
 #endif
 
 
+struct SortItem{
+    PyObject* key;
+    PyObject* value;
+};
+
+template<typename Less>
+static void _list_sort_impl(std::vector<SortItem>& items, Less less){
+    timsort(items.data(), (int)items.size(), [less](const SortItem& a, const SortItem& b){
+        return less(a.key, b.key);
+    });
+}
+
+static void list_sort(VM* vm, List& self, PyObject* key, bool reverse){
+    int n = self.size();
+    if(n < 2) return;
+    // keys and the values they came from must survive calls into python code
+    auto _lock = vm->heap.gc_scope_lock();
+    std::vector<SortItem> items(n);
+    // reverse before and after sorting, so that equal elements keep their order
+    for(int i=0; i<n; i++){
+        PyObject* obj = self[reverse ? n-1-i : i];
+        items[i].value = obj;
+        if(key != vm->None){
+            items[i].key = vm->call(key, obj);
+            // the key function may shrink the list before the next item is read
+            if(self.size() != n) vm->ValueError("list modified during sort");
+        }else{
+            items[i].key = obj;
+        }
+    }
+
+    // fast paths for homogeneous keys, which skip `__lt__` dispatch
+    bool all_int = true, all_float = true, all_str = true;
+    for(const SortItem& item: items){
+        all_int = all_int && is_small_int(item.key);
+        all_float = all_float && is_float(item.key);
+        all_str = all_str && is_non_tagged_type(item.key, vm->tp_str);
+        if(!all_int && !all_float && !all_str) break;
+    }
+    if(all_int){
+        _list_sort_impl(items, [](PyObject* a, PyObject* b){
+            return PK_BITS(a) < PK_BITS(b);     // tagging preserves the order
+        });
+    }else if(all_float){
+        _list_sort_impl(items, [](PyObject* a, PyObject* b){
+            return untag_float(a) < untag_float(b);
+        });
+    }else if(all_str){
+        _list_sort_impl(items, [](PyObject* a, PyObject* b){
+            return PK_OBJ_GET(Str, a) < PK_OBJ_GET(Str, b);
+        });
+    }else{
+        _list_sort_impl(items, [vm](PyObject* a, PyObject* b){
+            return vm->py_lt(a, b);
+        });
+    }
+
+    if(self.size() != n) vm->ValueError("list modified during sort");
+    for(int i=0; i<n; i++) self[reverse ? n-1-i : i] = items[i].value;
+}
+
+// ints and floats of a list, a tuple or a range
+static bool _as_number_array(VM* vm, PyObject* obj, ArgsView* out){
+    if(is_non_tagged_type(obj, vm->tp_list)){
+        List& list = PK_OBJ_GET(List, obj);
+        *out = ArgsView(list.begin(), list.end());
+        return true;
+    }
+    if(is_non_tagged_type(obj, vm->tp_tuple)){
+        *out = ArgsView(PK_OBJ_GET(Tuple, obj));
+        return true;
+    }
+    return false;
+}
+
+// `sum()` of ints and floats without dispatch
+struct NumberSum{
+    i64 i_sum = 0;
+    f64 f_sum = 0;
+    bool use_float = false;
+
+    // returns false if the sum overflows
+    bool add(i64 val){
+        if(use_float){
+            f_sum += val;
+            return true;
+        }
+        return !i64_add_overflow(i_sum, val, &i_sum);
+    }
+
+    // returns false if `obj` is not an int or a float, or the sum overflows
+    bool add(PyObject* obj){
+        i64 val;
+        if(try_cast_int(obj, &val)) return add(val);
+        if(!is_float(obj)) return false;
+        if(!use_float){
+            f_sum = (f64)i_sum;
+            use_float = true;
+        }
+        f_sum += untag_float(obj);
+        return true;
+    }
+
+    PyObject* result(VM* vm) const { return use_float ? VAR(f_sum) : VAR(i_sum); }
+};
+
+static PyObject* _py_min_max(VM* vm, ArgsView args, bool is_max){
+    const Tuple& items = CAST(Tuple&, args[0]);
+    PyObject* key = args[1];
+    const char* name = is_max ? "max" : "min";
+    if(items.size() == 0) vm->TypeError(fmt(name, " expected 1 arguments, got 0"));
+    PyObject* iterable = items.size() == 1 ? items[0] : args[0];
+
+    // fast paths for homogeneous numbers, the first one of equal items is returned
+    ArgsView array(nullptr, nullptr);
+    if(key == vm->None && _as_number_array(vm, iterable, &array) && !array.empty()){
+        bool all_int = true, all_float = true;
+        for(PyObject* obj: array){
+            all_int = all_int && is_small_int(obj);
+            all_float = all_float && is_float(obj);
+            if(!all_int && !all_float) break;
+        }
+        PyObject* res = array[0];
+        if(all_int){
+            for(PyObject* obj: array){
+                if(is_max ? PK_BITS(obj) > PK_BITS(res) : PK_BITS(obj) < PK_BITS(res)) res = obj;
+            }
+            return res;
+        }
+        if(all_float){
+            for(PyObject* obj: array){
+                if(is_max ? untag_float(obj) > untag_float(res) : untag_float(obj) < untag_float(res)) res = obj;
+            }
+            return res;
+        }
+    }
+    if(key == vm->None && is_non_tagged_type(iterable, vm->tp_range)){
+        const Range& r = PK_OBJ_GET(Range, iterable);
+        i64 n = 0;
+        if(r.step > 0 && r.stop > r.start) n = (r.stop - r.start + r.step - 1) / r.step;
+        if(r.step < 0 && r.start > r.stop) n = (r.start - r.stop - r.step - 1) / -r.step;
+        if(n > 0){
+            i64 last = r.start + (n - 1) * r.step;
+            return VAR(is_max == (r.step > 0) ? last : r.start);
+        }
+    }
+
+    // the iterator, the best item and its key are kept on the stack while python code runs
+    PyObject** slots = vm->s_data.end();
+    vm->s_data.push(vm->py_iter(iterable));
+    vm->s_data.push(vm->py_next(slots[0]));
+    if(slots[1] == vm->StopIteration) vm->ValueError(fmt(name, "() arg is an empty sequence"));
+    vm->s_data.push(key == vm->None ? slots[1] : vm->call(key, slots[1]));
+    while(true){
+        PyObject* obj = vm->py_next(slots[0]);
+        if(obj == vm->StopIteration) break;
+        vm->s_data.push(obj);
+        PyObject* obj_key = key == vm->None ? obj : vm->call(key, obj);
+        vm->s_data.push(obj_key);
+        if(is_max ? vm->py_lt(slots[2], obj_key) : vm->py_lt(obj_key, slots[2])){
+            slots[1] = obj;
+            slots[2] = obj_key;
+        }
+        vm->s_data.shrink(2);
+    }
+    PyObject* res = slots[1];
+    vm->s_data.reset(slots);
+    return res;
+}
+
+static bool is_set(VM* vm, PyObject* obj){
+    return vm->isinstance(obj, vm->tp_set) || vm->isinstance(obj, vm->tp_frozenset);
+}
+
+static void set_update(VM* vm, Set& self, PyObject* iterable){
+    if(is_set(vm, iterable)){
+        _CAST(Set&, iterable).apply([&](PyObject* k){ self.add(k); });
+        return;
+    }
+    auto _lock = vm->heap.gc_scope_lock();
+    PyObject* it = vm->py_iter(iterable);
+    PyObject* obj = vm->py_next(it);
+    while(obj != vm->StopIteration){
+        self.add(obj);
+        obj = vm->py_next(it);
+    }
+}
+
+// the other operand of a method like `set.union()` can be any iterable
+// the keys of a temporary set are not rooted, so callers hold a `gc_scope_lock()` while using it
+static Set set_of(VM* vm, PyObject* iterable){
+    if(is_set(vm, iterable)) return _CAST(Set&, iterable);
+    Set ret(vm);
+    set_update(vm, ret, iterable);
+    return ret;
+}
+
+// results have the type of `self`, like in cpython
+// results of set operations are plain sets, even for subclasses
+static PyObject* set_new(VM* vm, PyObject* self, Set&& s){
+    Type type = vm->isinstance(self, vm->tp_frozenset) ? vm->tp_frozenset : vm->tp_set;
+    return vm->heap.gcnew<Set>(type, std::move(s));
+}
+
+static PyObject* set_and(VM* vm, PyObject* self, const Set& other){
+    Set ret(vm);
+    _CAST(Set&, self).apply([&](PyObject* k){ if(other.contains(k)) ret.add(k); });
+    return set_new(vm, self, std::move(ret));
+}
+
+static PyObject* set_or(VM* vm, PyObject* self, const Set& other){
+    Set ret(_CAST(Set&, self));
+    other.apply([&](PyObject* k){ ret.add(k); });
+    return set_new(vm, self, std::move(ret));
+}
+
+static PyObject* set_sub(VM* vm, PyObject* self, const Set& other){
+    Set ret(vm);
+    _CAST(Set&, self).apply([&](PyObject* k){ if(!other.contains(k)) ret.add(k); });
+    return set_new(vm, self, std::move(ret));
+}
+
+static PyObject* set_xor(VM* vm, PyObject* self, const Set& other){
+    const Set& a = _CAST(Set&, self);
+    Set ret(vm);
+    a.apply([&](PyObject* k){ if(!other.contains(k)) ret.add(k); });
+    other.apply([&](PyObject* k){ if(!a.contains(k)) ret.add(k); });
+    return set_new(vm, self, std::move(ret));
+}
+
+static bool set_issubset(const Set& a, const Set& b){
+    if(a.size() > b.size()) return false;
+    bool ok = true;
+    a.apply([&](PyObject* k){ if(ok && !b.contains(k)) ok = false; });
+    return ok;
+}
+
+static bool is_long(VM* vm, PyObject* obj){
+    return is_non_tagged_type(obj, vm->tp_long);
+}
+
+// the value of an `int` or `long` operand, an `int` is promoted into `tmp`
+static const BigInt* as_bigint(VM* vm, PyObject* obj, BigInt& tmp){
+    i64 val;
+    if(try_cast_int(obj, &val)){
+        tmp = BigInt(val);
+        return &tmp;
+    }
+    if(is_long(vm, obj)) return &_CAST(BigInt&, obj);
+    return nullptr;
+}
+
+static void long_divmod(VM* vm, const BigInt& a, const BigInt& b, BigInt& q, BigInt& r){
+    if(b.is_zero()) vm->ZeroDivisionError();
+    BigInt::divmod(a, b, q, r);
+}
+
+static PyObject* long_pow(VM* vm, const BigInt& base, PyObject* exp_){
+    if(is_float(exp_)) return VAR(std::pow(base.to_f64(), _CAST(f64, exp_)));
+    i64 exp;
+    if(is_long(vm, exp_)){
+        if(!_CAST(BigInt&, exp_).to_i64(&exp)) vm->ValueError("exponent is too large");
+    }else{
+        exp = CAST(i64, exp_);
+    }
+    if(exp < 0){
+        if(base.is_zero()) vm->ZeroDivisionError("0.0 cannot be raised to a negative power");
+        return VAR(std::pow(base.to_f64(), (f64)exp));
+    }
+    return VAR(base.pow(exp));
+}
+
 void init_builtins(VM* _vm) {
-#define BIND_NUM_ARITH_OPT(name, op)                                                                    \
+    // `int` results that overflow i64 are promoted to `long`
+#define BIND_NUM_ARITH_OPT(name, op, overflow)                                                          \
     _vm->bind##name(_vm->tp_int, [](VM* vm, PyObject* lhs, PyObject* rhs) {                             \
-        if(is_int(rhs)) return VAR(_CAST(i64, lhs) op _CAST(i64, rhs));                                 \
+        if(is_int(rhs)){                                                                                \
+            i64 val;                                                                                    \
+            if(!overflow(_CAST(i64, lhs), _CAST(i64, rhs), &val)) return VAR(val);                      \
+            return VAR(BigInt(_CAST(i64, lhs)) op BigInt(_CAST(i64, rhs)));                             \
+        }                                                                                               \
         if(is_float(rhs)) return VAR(_CAST(i64, lhs) op _CAST(f64, rhs));                               \
+        if(is_long(vm, rhs)) return VAR(BigInt(_CAST(i64, lhs)) op _CAST(BigInt&, rhs));                \
         return vm->NotImplemented;                                                                      \
     });                                                                                                 \
     _vm->bind##name(_vm->tp_float, [](VM* vm, PyObject* lhs, PyObject* rhs) {                           \
@@ -86,9 +364,9 @@ void init_builtins(VM* _vm) {
         return vm->NotImplemented;                                                                      \
     });
 
-    BIND_NUM_ARITH_OPT(__add__, +)
-    BIND_NUM_ARITH_OPT(__sub__, -)
-    BIND_NUM_ARITH_OPT(__mul__, *)
+    BIND_NUM_ARITH_OPT(__add__, +, i64_add_overflow)
+    BIND_NUM_ARITH_OPT(__sub__, -, i64_sub_overflow)
+    BIND_NUM_ARITH_OPT(__mul__, *, i64_mul_overflow)
 
 #undef BIND_NUM_ARITH_OPT
 
@@ -97,6 +375,7 @@ void init_builtins(VM* _vm) {
         i64 val;                                                                \
         if(try_cast_int(rhs, &val)) return VAR(_CAST(i64, lhs) op val);         \
         if(is_float(rhs))   return VAR(_CAST(i64, lhs) op _CAST(f64, rhs));     \
+        if(is_long(vm, rhs)) return VAR(BigInt(_CAST(i64, lhs)).cmp(_CAST(BigInt&, rhs)) op 0);  \
         return vm->NotImplemented;                                              \
     });                                                                         \
     _vm->bind##name(_vm->tp_float, [](VM* vm, PyObject* lhs, PyObject* rhs) {   \
@@ -126,6 +405,8 @@ void init_builtins(VM* _vm) {
             if(frame->_callable != nullptr){
                 class_arg = frame->_callable->attr().try_get(__class__);
                 if(frame->_locals.size() > 0) self_arg = frame->_locals[0];
+                // `self` is in a cell if a nested function captures it
+                if(self_arg != nullptr && is_non_tagged_type(self_arg, vm->tp_cell)) self_arg = PK_OBJ_GET(Cell, self_arg).value;
             }
             if(class_arg == nullptr || self_arg == nullptr){
                 vm->TypeError("super(): unable to determine the class context, use super(class, self) instead");
@@ -177,12 +458,58 @@ void init_builtins(VM* _vm) {
     });
 
     _vm->bind_builtin_func<1>("abs", [](VM* vm, ArgsView args) {
-        if(is_int(args[0])) return VAR(std::abs(_CAST(i64, args[0])));
+        if(is_int(args[0])){
+            i64 val = _CAST(i64, args[0]);
+            if(val == INT64_MIN) return VAR(BigInt(val).abs());
+            return VAR(std::abs(val));
+        }
         if(is_float(args[0])) return VAR(std::abs(_CAST(f64, args[0])));
+        if(is_long(vm, args[0])) return VAR(_CAST(BigInt&, args[0]).abs());
         vm->TypeError("bad operand type for abs()");
         return vm->None;
     });
 
+    _vm->bind(_vm->builtins, "sum(iterable, start=0)", [](VM* vm, ArgsView args) {
+        // fast paths for lists, tuples and ranges of numbers
+        NumberSum sum;
+        ArgsView array(nullptr, nullptr);
+        if(sum.add(args[1])){
+            bool ok = false;
+            if(_as_number_array(vm, args[0], &array)){
+                ok = true;
+                for(PyObject* obj: array) if(!sum.add(obj)){ ok = false; break; }
+            }else if(is_non_tagged_type(args[0], vm->tp_range)){
+                const Range& r = PK_OBJ_GET(Range, args[0]);
+                ok = true;
+                for(i64 i=r.start; r.step>0 ? i<r.stop : i>r.stop; i+=r.step){
+                    if(!sum.add(i)){ ok = false; break; }
+                }
+            }
+            if(ok) return sum.result(vm);
+        }
+
+        // the iterator and the partial sum are kept on the stack while python code runs
+        PyObject** slots = vm->s_data.end();
+        vm->s_data.push(vm->py_iter(args[0]));
+        vm->s_data.push(args[1]);
+        PyObject* obj = vm->py_next(slots[0]);
+        while(obj != vm->StopIteration){
+            slots[1] = vm->py_add(slots[1], obj);
+            obj = vm->py_next(slots[0]);
+        }
+        PyObject* res = slots[1];
+        vm->s_data.reset(slots);
+        return res;
+    });
+
+    _vm->bind(_vm->builtins, "max(*args, key=None)", [](VM* vm, ArgsView args) {
+        return _py_min_max(vm, args, true);
+    });
+
+    _vm->bind(_vm->builtins, "min(*args, key=None)", [](VM* vm, ArgsView args) {
+        return _py_min_max(vm, args, false);
+    });
+
     _vm->bind_builtin_func<1>("id", [](VM* vm, ArgsView args) {
         PyObject* obj = args[0];
         if(is_tagged(obj)) return vm->None;
@@ -229,6 +556,11 @@ void init_builtins(VM* _vm) {
     _vm->bind_builtin_func<2>("divmod", [](VM* vm, ArgsView args) {
         if(is_int(args[0])){
             i64 lhs = _CAST(i64, args[0]);
+            if(is_long(vm, args[1]) || (lhs == INT64_MIN && is_int(args[1]) && _CAST(i64, args[1]) == -1)){
+                BigInt tmp, q, r;
+                long_divmod(vm, BigInt(lhs), *as_bigint(vm, args[1], tmp), q, r);
+                return VAR(Tuple({VAR(std::move(q)), VAR(std::move(r))}));
+            }
             i64 rhs = CAST(i64, args[1]);
             if(rhs == 0) vm->ZeroDivisionError();
             auto res = std::div(lhs, rhs);
@@ -238,6 +570,40 @@ void init_builtins(VM* _vm) {
         }
     });
 
+    _vm->bind(_vm->builtins, "pow(base, exp, mod=None)", [](VM* vm, ArgsView args) {
+        if(args[2] == vm->None) return vm->call_method(args[0], __pow__, args[1]);
+        BigInt tmp0, tmp1, tmp2;
+        const BigInt* base = as_bigint(vm, args[0], tmp0);
+        const BigInt* exp = as_bigint(vm, args[1], tmp1);
+        const BigInt* mod = as_bigint(vm, args[2], tmp2);
+        if(base == nullptr || exp == nullptr || mod == nullptr){
+            vm->TypeError("pow() 3rd argument not allowed unless all arguments are integers");
+        }
+        if(exp->neg) vm->ValueError("pow() 2nd argument cannot be negative when 3rd argument specified");
+        if(mod->is_zero()) vm->ValueError("pow() 3rd argument cannot be 0");
+        bool is_all_int = !is_long(vm, args[0]) && !is_long(vm, args[1]) && !is_long(vm, args[2]);
+        i64 m = is_all_int ? _CAST(i64, args[2]) : 0;
+        if(is_all_int && m > -(1ll << 32) && m < (1ll << 32)){
+            // the residues are below 2**32, so their products fit in 64 bits
+            uint64_t um = m < 0 ? -m : m;
+            i64 b = _CAST(i64, args[0]) % (i64)um;
+            uint64_t base = b < 0 ? b + um : b;
+            uint64_t ret = 1 % um;
+            for(i64 e = _CAST(i64, args[1]); e; e >>= 1){
+                if(e & 1) ret = ret * base % um;
+                base = base * base % um;
+            }
+            // the result has the sign of `mod`
+            if(m < 0 && ret != 0) return VAR((i64)ret - (i64)um);
+            return VAR((i64)ret);
+        }
+        BigInt ret = BigInt::pow_mod(*base, *exp, *mod);
+        // |ret| < |mod|, so it fits in an `int` if `mod` does
+        i64 val;
+        if(is_all_int && ret.to_i64(&val)) return VAR(val);
+        return VAR(std::move(ret));
+    });
+
     _vm->bind_builtin_func<1>("eval", [](VM* vm, ArgsView args) {
         CodeObject_ code = vm->compile(CAST(Str&, args[0]), "<eval>", EVAL_MODE, true);
         FrameId frame = vm->top_frame();
@@ -354,6 +720,9 @@ void init_builtins(VM* _vm) {
     _vm->cached_object__new__ = _vm->bind_constructor<1>("object", [](VM* vm, ArgsView args) {
         vm->check_non_tagged_type(args[0], vm->tp_type);
         Type t = PK_OBJ_GET(Type, args[0]);
+        // native methods of these types expect their own layout
+        if(vm->issubclass(t, vm->tp_set)) vm->TypeError("object.__new__() is not safe, use set.__new__()");
+        if(vm->issubclass(t, vm->tp_frozenset)) vm->TypeError("object.__new__() is not safe, use frozenset.__new__()");
         return vm->heap.gcnew<DummyInstance>(t);
     });
 
@@ -404,13 +773,14 @@ void init_builtins(VM* _vm) {
                 if(lhs == 0) vm->ZeroDivisionError("0.0 cannot be raised to a negative power");
                 return VAR((f64)std::pow(lhs, rhs));
             }
-            i64 ret = 1;
-            while(rhs){
-                if(rhs & 1) ret *= lhs;
-                lhs *= lhs;
-                rhs >>= 1;
+            i64 ret = 1, base = lhs;
+            for(i64 exp = rhs; exp; exp >>= 1){
+                if((exp & 1) && i64_mul_overflow(ret, base, &ret)) return VAR(BigInt(lhs).pow(rhs));
+                if(exp > 1 && i64_mul_overflow(base, base, &base)) return VAR(BigInt(lhs).pow(rhs));
             }
             return VAR(ret);
+        }else if(is_int(lhs_) && is_long(vm, rhs_)){
+            return long_pow(vm, BigInt(lhs), rhs_);
         }else{
             return VAR((f64)std::pow(CAST_F(lhs_), CAST_F(rhs_)));
         }
@@ -427,6 +797,12 @@ void init_builtins(VM* _vm) {
             if (is_type(args[1], vm->tp_float)) return VAR((i64)CAST(f64, args[1]));
             if (is_type(args[1], vm->tp_int)) return args[1];
             if (is_type(args[1], vm->tp_bool)) return VAR(_CAST(bool, args[1]) ? 1 : 0);
+            if (is_type(args[1], vm->tp_long)){
+                // like python2, a value out of range stays `long`
+                i64 val;
+                if(_CAST(BigInt&, args[1]).to_i64(&val)) return VAR(val);
+                return args[1];
+            }
         }
         if(args.size() > 1+2) vm->TypeError("int() takes at most 2 arguments");
         // 2 args
@@ -437,7 +813,7 @@ void init_builtins(VM* _vm) {
             try{
                 size_t parsed = 0;
                 i64 val = std::stoll(s.str(), &parsed, base);
-                PK_ASSERT(parsed == s.length());
+                PK_ASSERT((int)parsed == s.length());
                 return VAR(val);
             }catch(...){
                 vm->ValueError("invalid literal for int(): " + s.escape());
@@ -456,39 +832,220 @@ void init_builtins(VM* _vm) {
     });
 
     _vm->bind__floordiv__(_vm->tp_int, [](VM* vm, PyObject* lhs_, PyObject* rhs_) {
+        i64 lhs = _CAST(i64, lhs_);
+        if(is_long(vm, rhs_)){
+            BigInt q, r;
+            long_divmod(vm, BigInt(lhs), _CAST(BigInt&, rhs_), q, r);
+            return VAR(std::move(q));
+        }
         i64 rhs = CAST(i64, rhs_);
         if(rhs == 0) vm->ZeroDivisionError();
-        return VAR(_CAST(i64, lhs_) / rhs);
+        if(lhs == INT64_MIN && rhs == -1) return VAR(-BigInt(lhs));
+        return VAR(lhs / rhs);
     });
 
     _vm->bind__mod__(_vm->tp_int, [](VM* vm, PyObject* lhs_, PyObject* rhs_) {
+        i64 lhs = _CAST(i64, lhs_);
+        if(is_long(vm, rhs_)){
+            BigInt q, r;
+            long_divmod(vm, BigInt(lhs), _CAST(BigInt&, rhs_), q, r);
+            return VAR(std::move(r));
+        }
         i64 rhs = CAST(i64, rhs_);
         if(rhs == 0) vm->ZeroDivisionError();
-        return VAR(_CAST(i64, lhs_) % rhs);
+        if(rhs == -1) return VAR(0);
+        return VAR(lhs % rhs);
     });
 
     _vm->bind__repr__(_vm->tp_int, [](VM* vm, PyObject* obj) { return VAR(std::to_string(_CAST(i64, obj))); });
     _vm->bind__json__(_vm->tp_int, [](VM* vm, PyObject* obj) { return VAR(std::to_string(_CAST(i64, obj))); });
 
-    _vm->bind__neg__(_vm->tp_int, [](VM* vm, PyObject* obj) { return VAR(-_CAST(i64, obj)); });
+    _vm->bind__neg__(_vm->tp_int, [](VM* vm, PyObject* obj) {
+        i64 val = _CAST(i64, obj);
+        if(val == INT64_MIN) return VAR(-BigInt(val));
+        return VAR(-val);
+    });
 
     _vm->bind__hash__(_vm->tp_int, [](VM* vm, PyObject* obj) { return _CAST(i64, obj); });
 
     _vm->bind__invert__(_vm->tp_int, [](VM* vm, PyObject* obj) { return VAR(~_CAST(i64, obj)); });
 
+    _vm->bind__lshift__(_vm->tp_int, [](VM* vm, PyObject* lhs_, PyObject* rhs_) {
+        i64 lhs = _CAST(i64, lhs_);
+        i64 rhs = CAST(i64, rhs_);
+        if(rhs < 0) vm->ValueError("negative shift count");
+        // the bits shifted out must all be copies of the sign bit
+        if(rhs < 63 && (lhs >> (63 - rhs)) == (lhs >> 63)) return VAR((i64)((uint64_t)lhs << rhs));
+        return VAR(BigInt(lhs) << rhs);
+    });
+
+    _vm->bind__rshift__(_vm->tp_int, [](VM* vm, PyObject* lhs_, PyObject* rhs_) {
+        i64 lhs = _CAST(i64, lhs_);
+        i64 rhs = CAST(i64, rhs_);
+        if(rhs < 0) vm->ValueError("negative shift count");
+        if(rhs > 63) return VAR(lhs < 0 ? -1 : 0);
+        return VAR(lhs >> rhs);
+    });
+
 #define INT_BITWISE_OP(name, op) \
     _vm->bind##name(_vm->tp_int, [](VM* vm, PyObject* lhs, PyObject* rhs) { \
+        if(is_long(vm, rhs)) return VAR(BigInt(_CAST(i64, lhs)) op _CAST(BigInt&, rhs)); \
         return VAR(_CAST(i64, lhs) op CAST(i64, rhs)); \
     });
 
-    INT_BITWISE_OP(__lshift__, <<)
-    INT_BITWISE_OP(__rshift__, >>)
     INT_BITWISE_OP(__and__, &)
     INT_BITWISE_OP(__or__, |)
     INT_BITWISE_OP(__xor__, ^)
 
 #undef INT_BITWISE_OP
 
+    /************ long ************/
+    _vm->bind_constructor<-1>("long", [](VM* vm, ArgsView args) {
+        if(args.size() == 1+0) return VAR(BigInt());
+        if(args.size() > 1+1) vm->TypeError("long() takes at most 1 argument");
+        PyObject* x = args[1];
+        i64 val;
+        if(try_cast_int(x, &val)) return VAR(BigInt(val));
+        if(is_long(vm, x)) return x;
+        if(is_float(x)){
+            f64 f = _CAST(f64, x);
+            if(!std::isfinite(f)) vm->ValueError("cannot convert " + CAST(Str&, vm->py_repr(x)) + " to long");
+            return VAR(BigInt::from_f64(f));
+        }
+        if(is_type(x, vm->tp_bool)) return VAR(BigInt(_CAST(bool, x) ? 1 : 0));
+        if(is_type(x, vm->tp_str)){
+            const Str& s = _CAST(Str&, x);
+            BigInt value;
+            if(!BigInt::from_str(s.sv(), value)) vm->ValueError("invalid literal for long(): " + s.escape());
+            return VAR(std::move(value));
+        }
+        vm->TypeError("invalid arguments for long()");
+        return vm->None;
+    });
+
+#define BIND_LONG_ARITH_OPT(name, op)                                                       \
+    _vm->bind##name(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {                \
+        BigInt tmp;                                                                         \
+        const BigInt* other = as_bigint(vm, rhs, tmp);                                      \
+        if(other != nullptr) return VAR(_CAST(BigInt&, lhs) op *other);                     \
+        if(is_float(rhs)) return VAR(_CAST(BigInt&, lhs).to_f64() op _CAST(f64, rhs));      \
+        return vm->NotImplemented;                                                          \
+    });
+
+    BIND_LONG_ARITH_OPT(__add__, +)
+    BIND_LONG_ARITH_OPT(__sub__, -)
+    BIND_LONG_ARITH_OPT(__mul__, *)
+
+#undef BIND_LONG_ARITH_OPT
+
+    // `int` operands are handled by `int` itself, only `float` gets here
+    _vm->bind_method<1>("long", "__radd__", [](VM* vm, ArgsView args) {
+        if(!is_float(args[1])) return vm->NotImplemented;
+        return VAR(_CAST(f64, args[1]) + _CAST(BigInt&, args[0]).to_f64());
+    });
+
+    _vm->bind_method<1>("long", "__rsub__", [](VM* vm, ArgsView args) {
+        if(!is_float(args[1])) return vm->NotImplemented;
+        return VAR(_CAST(f64, args[1]) - _CAST(BigInt&, args[0]).to_f64());
+    });
+
+    _vm->bind_method<1>("long", "__rmul__", [](VM* vm, ArgsView args) {
+        if(!is_float(args[1])) return vm->NotImplemented;
+        return VAR(_CAST(f64, args[1]) * _CAST(BigInt&, args[0]).to_f64());
+    });
+
+#define BIND_LONG_LOGICAL_OPT(name, op)                                                     \
+    _vm->bind##name(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {                \
+        BigInt tmp;                                                                         \
+        const BigInt* other = as_bigint(vm, rhs, tmp);                                      \
+        if(other != nullptr) return VAR(_CAST(BigInt&, lhs).cmp(*other) op 0);             \
+        if(is_float(rhs)) return VAR(_CAST(BigInt&, lhs).to_f64() op _CAST(f64, rhs));      \
+        return vm->NotImplemented;                                                          \
+    });
+
+    BIND_LONG_LOGICAL_OPT(__eq__, ==)
+    BIND_LONG_LOGICAL_OPT(__lt__, <)
+    BIND_LONG_LOGICAL_OPT(__le__, <=)
+    BIND_LONG_LOGICAL_OPT(__gt__, >)
+    BIND_LONG_LOGICAL_OPT(__ge__, >=)
+
+#undef BIND_LONG_LOGICAL_OPT
+
+    _vm->bind__truediv__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        f64 value = CAST_F(rhs);
+        return VAR(_CAST(BigInt&, lhs).to_f64() / value);
+    });
+
+    _vm->bind__floordiv__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        BigInt tmp, q, r;
+        const BigInt* other = as_bigint(vm, rhs, tmp);
+        if(other == nullptr) return vm->NotImplemented;
+        long_divmod(vm, _CAST(BigInt&, lhs), *other, q, r);
+        return VAR(std::move(q));
+    });
+
+    _vm->bind__mod__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        BigInt tmp, q, r;
+        const BigInt* other = as_bigint(vm, rhs, tmp);
+        if(other == nullptr) return vm->NotImplemented;
+        long_divmod(vm, _CAST(BigInt&, lhs), *other, q, r);
+        return VAR(std::move(r));
+    });
+
+    _vm->bind_method<1>("long", "__divmod__", [](VM* vm, ArgsView args) {
+        BigInt tmp, q, r;
+        const BigInt* other = as_bigint(vm, args[1], tmp);
+        if(other == nullptr) vm->TypeError("unsupported operand type(s) for divmod()");
+        long_divmod(vm, _CAST(BigInt&, args[0]), *other, q, r);
+        return VAR(Tuple({VAR(std::move(q)), VAR(std::move(r))}));
+    });
+
+    _vm->bind__pow__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        return long_pow(vm, _CAST(BigInt&, lhs), rhs);
+    });
+
+    _vm->bind__lshift__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        i64 n = CAST(i64, rhs);
+        if(n < 0) vm->ValueError("negative shift count");
+        return VAR(_CAST(BigInt&, lhs) << n);
+    });
+
+    _vm->bind__rshift__(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {
+        i64 n = CAST(i64, rhs);
+        if(n < 0) vm->ValueError("negative shift count");
+        return VAR(_CAST(BigInt&, lhs) >> n);
+    });
+
+#define LONG_BITWISE_OP(name, op)                                                           \
+    _vm->bind##name(_vm->tp_long, [](VM* vm, PyObject* lhs, PyObject* rhs) {                \
+        BigInt tmp;                                                                         \
+        const BigInt* other = as_bigint(vm, rhs, tmp);                                      \
+        if(other == nullptr) return vm->NotImplemented;                                     \
+        return VAR(_CAST(BigInt&, lhs) op *other);                                          \
+    });
+
+    LONG_BITWISE_OP(__and__, &)
+    LONG_BITWISE_OP(__or__, |)
+    LONG_BITWISE_OP(__xor__, ^)
+
+#undef LONG_BITWISE_OP
+
+    _vm->bind__neg__(_vm->tp_long, [](VM* vm, PyObject* obj) { return VAR(-_CAST(BigInt&, obj)); });
+    _vm->bind__invert__(_vm->tp_long, [](VM* vm, PyObject* obj) { return VAR(~_CAST(BigInt&, obj)); });
+    _vm->bind__hash__(_vm->tp_long, [](VM* vm, PyObject* obj) { return _CAST(BigInt&, obj).hash(); });
+
+    _vm->bind__repr__(_vm->tp_long, [](VM* vm, PyObject* obj) { return VAR(_CAST(BigInt&, obj).to_string() + "L"); });
+    _vm->bind__str__(_vm->tp_long, [](VM* vm, PyObject* obj) { return VAR(_CAST(BigInt&, obj).to_string()); });
+    _vm->bind__json__(_vm->tp_long, [](VM* vm, PyObject* obj) { return VAR(_CAST(BigInt&, obj).to_string()); });
+
+    _vm->bind_method<0>("long", "bit_length", [](VM* vm, ArgsView args) {
+        return VAR(_CAST(BigInt&, args[0]).bit_length());
+    });
+
+    _vm->bind_method<0>("long", "__getnewargs__", [](VM* vm, ArgsView args) {
+        return VAR(Tuple({VAR(_CAST(BigInt&, args[0]).to_string())}));
+    });
+
     /************ float ************/
     _vm->bind_constructor<-1>("float", [](VM* vm, ArgsView args) {
         if(args.size() == 1+0) return VAR(0.0);
@@ -496,6 +1053,7 @@ void init_builtins(VM* _vm) {
         // 1 arg
         if (is_type(args[1], vm->tp_int)) return VAR((f64)CAST(i64, args[1]));
         if (is_type(args[1], vm->tp_float)) return args[1];
+        if (is_type(args[1], vm->tp_long)) return VAR(_CAST(BigInt&, args[1]).to_f64());
         if (is_type(args[1], vm->tp_bool)) return VAR(_CAST(bool, args[1]) ? 1.0 : 0.0);
         if (is_type(args[1], vm->tp_str)) {
             const Str& s = CAST(Str&, args[1]);
@@ -529,9 +1087,9 @@ void init_builtins(VM* _vm) {
         return VAR(s);
     });
     _vm->bind__json__(_vm->tp_float, [](VM* vm, PyObject* obj) {
-        f64 val = _CAST(f64, obj);
-        if(std::isinf(val) || std::isnan(val)) vm->ValueError("cannot jsonify 'nan' or 'inf'");
-        return VAR(std::to_string(val));
+        JsonWriter writer(vm);
+        writer.write_float(_CAST(f64, obj));
+        return VAR(writer.str());
     });
 
     /************ str ************/
@@ -574,8 +1132,9 @@ void init_builtins(VM* _vm) {
         return VAR(self.escape(true));
     });
     _vm->bind__json__(_vm->tp_str, [](VM* vm, PyObject* obj) {
-        const Str& self = _CAST(Str&, obj);
-        return VAR(self.escape(false));
+        JsonWriter writer(vm);
+        writer.write_str(_CAST(Str&, obj));
+        return VAR(writer.str());
     });
 
 #define BIND_CMP_STR(name, op) \
@@ -617,7 +1176,7 @@ void init_builtins(VM* _vm) {
         const Str& self = _CAST(Str&, args[0]);
         std::vector<std::string_view> parts = self.split(CAST(Str&, args[1]));
         List ret(parts.size());
-        for(int i=0; i<parts.size(); i++) ret[i] = VAR(Str(parts[i]));
+        for(int i=0; i<(int)parts.size(); i++) ret[i] = VAR(Str(parts[i]));
         return VAR(std::move(ret));
     });
 
@@ -711,15 +1270,9 @@ void init_builtins(VM* _vm) {
     });
 
     _vm->bind__json__(_vm->tp_list, [](VM* vm, PyObject* _0){
-        List& iterable = _CAST(List&, _0);
-        std::stringstream ss;
-        ss << '[';
-        for(int i=0; i<iterable.size(); i++){
-            ss << CAST(Str&, vm->py_json(iterable[i]));
-            if(i != iterable.size()-1) ss << ", ";
-        }
-        ss << ']';
-        return VAR(ss.str());
+        JsonWriter writer(vm);
+        writer.write_list(_0);
+        return VAR(writer.str());
     });
 
     _vm->bind__repr__(_vm->tp_tuple, [](VM* vm, PyObject* _0){
@@ -740,15 +1293,9 @@ void init_builtins(VM* _vm) {
     });
 
     _vm->bind__json__(_vm->tp_tuple, [](VM* vm, PyObject* _0){
-        Tuple& iterable = _CAST(Tuple&, _0);
-        std::stringstream ss;
-        ss << '[';
-        for(int i=0; i<iterable.size(); i++){
-            ss << CAST(Str&, vm->py_json(iterable[i]));
-            if(i != iterable.size()-1) ss << ", ";
-        }
-        ss << ']';
-        return VAR(ss.str());
+        JsonWriter writer(vm);
+        writer.write_tuple(_0);
+        return VAR(writer.str());
     });
 
     _vm->bind_constructor<-1>("list", [](VM* vm, ArgsView args) {
@@ -827,6 +1374,7 @@ void init_builtins(VM* _vm) {
     _vm->bind_method<1>("list", "append", [](VM* vm, ArgsView args) {
         List& self = _CAST(List&, args[0]);
         self.push_back(args[1]);
+        vm->heap.write_barrier(args[0]);
         return vm->None;
     });
 
@@ -839,6 +1387,7 @@ void init_builtins(VM* _vm) {
             self.push_back(obj);
             obj = vm->py_next(it);
         }
+        vm->heap.write_barrier(args[0]);
         return vm->None;
     });
 
@@ -848,6 +1397,14 @@ void init_builtins(VM* _vm) {
         return vm->None;
     });
 
+    _vm->bind(_vm->_t(_vm->tp_list), "sort(self, key=None, reverse=False)", [](VM* vm, ArgsView args) {
+        List& self = _CAST(List&, args[0]);
+        PyObject* key = args[1];
+        bool reverse = CAST(bool, args[2]);
+        list_sort(vm, self, key, reverse);
+        return vm->None;
+    });
+
     _vm->bind__mul__(_vm->tp_list, [](VM* vm, PyObject* lhs, PyObject* rhs) {
         const List& self = _CAST(List&, lhs);
         if(!is_int(rhs)) return vm->NotImplemented;
@@ -874,6 +1431,7 @@ void init_builtins(VM* _vm) {
         if(index < 0) index = 0;
         if(index > self.size()) index = self.size();
         self.insert(index, args[2]);
+        vm->heap.write_barrier(args[0]);
         return vm->None;
     });
 
@@ -905,6 +1463,7 @@ void init_builtins(VM* _vm) {
         int i = CAST(int, index);
         i = vm->normalized_index(i, self.size());
         self[i] = value;
+        vm->heap.write_barrier(obj);
     });
     _vm->bind__delitem__(_vm->tp_list, [](VM* vm, PyObject* obj, PyObject* index){
         List& self = _CAST(List&, obj);
@@ -1050,8 +1609,7 @@ void init_builtins(VM* _vm) {
 
     _vm->bind__hash__(_vm->tp_bytes, [](VM* vm, PyObject* obj) {
         const Bytes& self = _CAST(Bytes&, obj);
-        std::string_view view((char*)self.data(), self.size());
-        return (i64)std::hash<std::string_view>()(view);
+        return (i64)wyhash(self.data(), self.size());
     });
 
     _vm->bind__repr__(_vm->tp_bytes, [](VM* vm, PyObject* obj) {
@@ -1177,6 +1735,7 @@ void init_builtins(VM* _vm) {
                 }
                 self.set(t[0], t[1]);
             }
+            vm->heap.write_barrier(args[0]);
             return vm->None;
         }
         vm->TypeError("dict() takes at most 1 argument");
@@ -1197,6 +1756,7 @@ void init_builtins(VM* _vm) {
     _vm->bind__setitem__(_vm->tp_dict, [](VM* vm, PyObject* obj, PyObject* key, PyObject* value) {
         Dict& self = _CAST(Dict&, obj);
         self.set(key, value);
+        vm->heap.write_barrier(obj);
     });
 
     _vm->bind__delitem__(_vm->tp_dict, [](VM* vm, PyObject* obj, PyObject* key) {
@@ -1226,19 +1786,15 @@ void init_builtins(VM* _vm) {
     //     Dict& self = _CAST(Dict&, args[0]);
     //     std::stringstream ss;
     //     ss << "[\n";
-    //     for(int i=0; i<self._capacity; i++){
+    //     for(int i=0; i<self._items_len; i++){
     //         auto item = self._items[i];
     //         Str key("None");
     //         Str value("None");
     //         if(item.first != nullptr){
     //             key = CAST(Str&, vm->py_repr(item.first));
-    //         }
-    //         if(item.second != nullptr){
     //             value = CAST(Str&, vm->py_repr(item.second));
     //         }
-    //         int prev = self._nodes[i].prev;
-    //         int next = self._nodes[i].next;
-    //         ss << "  [" << key << ", " << value << ", " << prev << ", " << next << "],\n";
+    //         ss << "  [" << key << ", " << value << ", " << item.hash << "],\n";
     //     }
     //     ss << "]\n";
     //     vm->stdout_write(ss.str());
@@ -1294,6 +1850,7 @@ void init_builtins(VM* _vm) {
         Dict& self = _CAST(Dict&, args[0]);
         const Dict& other = CAST(Dict&, args[1]);
         self.update(other);
+        vm->heap.write_barrier(args[0]);
         return vm->None;
     });
 
@@ -1327,21 +1884,9 @@ void init_builtins(VM* _vm) {
     });
 
     _vm->bind__json__(_vm->tp_dict, [](VM* vm, PyObject* obj) {
-        Dict& self = _CAST(Dict&, obj);
-        std::stringstream ss;
-        ss << "{";
-        bool first = true;
-
-        self.apply([&](PyObject* k, PyObject* v){
-            if(!first) ss << ", ";
-            first = false;
-            Str key = CAST(Str&, k).escape(false);
-            Str value = CAST(Str&, vm->py_json(v));
-            ss << key << ": " << value;
-        });
-
-        ss << "}";
-        return VAR(ss.str());
+        JsonWriter writer(vm);
+        writer.write_dict(obj);
+        return VAR(writer.str());
     });
 
     _vm->bind__eq__(_vm->tp_dict, [](VM* vm, PyObject* a, PyObject* b) {
@@ -1349,7 +1894,7 @@ void init_builtins(VM* _vm) {
         if(!is_non_tagged_type(b, vm->tp_dict)) return vm->NotImplemented;
         Dict& other = _CAST(Dict&, b);
         if(self.size() != other.size()) return vm->False;
-        for(int i=0; i<self._capacity; i++){
+        for(int i=0; i<self._items_len; i++){
             auto item = self._items[i];
             if(item.first == nullptr) continue;
             PyObject* value = other.try_get(item.first);
@@ -1359,6 +1904,177 @@ void init_builtins(VM* _vm) {
         return vm->True;
     });
 
+    /************ set ************/
+    for(Type type: {_vm->tp_set, _vm->tp_frozenset}){
+        _vm->_all_types[type].subclass_enabled = true;
+
+        _vm->bind_constructor<-1>(_vm->_t(type), [](VM* vm, ArgsView args){
+            if(args.size() > 1+1) vm->TypeError("expected at most 1 argument");
+            Set self(vm);
+            if(args.size() == 1+1) set_update(vm, self, args[1]);
+            Type cls = PK_OBJ_GET(Type, args[0]);
+            PyObject* obj = vm->heap.gcnew<Set>(cls, std::move(self));
+            // instances of python subclasses can have attributes
+            if(cls != vm->tp_set && cls != vm->tp_frozenset) obj->enable_instance_dict();
+            return obj;
+        });
+
+        _vm->bind__len__(type, [](VM* vm, PyObject* obj) {
+            return (i64)_CAST(Set&, obj).size();
+        });
+
+        _vm->bind__contains__(type, [](VM* vm, PyObject* obj, PyObject* key) {
+            return VAR(_CAST(Set&, obj).contains(key));
+        });
+
+        _vm->bind__iter__(type, [](VM* vm, PyObject* obj) {
+            return vm->py_iter(VAR(_CAST(Set&, obj).keys()));
+        });
+
+        _vm->bind__repr__(type, [](VM* vm, PyObject* obj) {
+            const Set& self = _CAST(Set&, obj);
+            // `{1, 2}` for sets, `name({1, 2})` for frozensets and subclasses
+            bool wrapped = !is_non_tagged_type(obj, vm->tp_set);
+            const Str& name = vm->_all_types[vm->_tp(obj)].name;
+            if(self.size() == 0) return VAR(name + "()");
+            std::stringstream ss;
+            if(wrapped) ss << name << "(";
+            ss << "{";
+            bool first = true;
+            self.apply([&](PyObject* k){
+                if(!first) ss << ", ";
+                first = false;
+                ss << CAST(Str&, vm->py_repr(k));
+            });
+            ss << "}";
+            if(wrapped) ss << ")";
+            return VAR(ss.str());
+        });
+
+        _vm->bind__eq__(type, [](VM* vm, PyObject* a, PyObject* b) {
+            if(!is_set(vm, b)) return vm->NotImplemented;
+            const Set& self = _CAST(Set&, a);
+            const Set& other = _CAST(Set&, b);
+            return VAR(self.size() == other.size() && set_issubset(self, other));
+        });
+
+#define BIND_SET_COMPARE(name, expr)                                        \
+        _vm->bind##name(type, [](VM* vm, PyObject* a, PyObject* b) {        \
+            if(!is_set(vm, b)) return vm->NotImplemented;                   \
+            const Set& self = _CAST(Set&, a);                               \
+            const Set& other = _CAST(Set&, b);                              \
+            return VAR(expr);                                               \
+        });
+
+        BIND_SET_COMPARE(__le__, set_issubset(self, other))
+        BIND_SET_COMPARE(__lt__, self.size() < other.size() && set_issubset(self, other))
+        BIND_SET_COMPARE(__ge__, set_issubset(other, self))
+        BIND_SET_COMPARE(__gt__, other.size() < self.size() && set_issubset(other, self))
+#undef BIND_SET_COMPARE
+
+#define BIND_SET_BINARY(name, method, f)                                    \
+        _vm->bind##name(type, [](VM* vm, PyObject* a, PyObject* b) {        \
+            if(!is_set(vm, b)) return vm->NotImplemented;                   \
+            return f(vm, a, _CAST(Set&, b));                                \
+        });                                                                 \
+        _vm->bind_method<1>(_vm->_t(type), method, [](VM* vm, ArgsView args) {   \
+            auto _lock = vm->heap.gc_scope_lock();                          \
+            return f(vm, args[0], set_of(vm, args[1]));                     \
+        });
+
+        BIND_SET_BINARY(__and__, "intersection", set_and)
+        BIND_SET_BINARY(__or__, "union", set_or)
+        BIND_SET_BINARY(__sub__, "difference", set_sub)
+        BIND_SET_BINARY(__xor__, "symmetric_difference", set_xor)
+#undef BIND_SET_BINARY
+
+        _vm->bind_method<1>(_vm->_t(type), "issubset", [](VM* vm, ArgsView args) {
+            auto _lock = vm->heap.gc_scope_lock();
+            return VAR(set_issubset(_CAST(Set&, args[0]), set_of(vm, args[1])));
+        });
+
+        _vm->bind_method<1>(_vm->_t(type), "issuperset", [](VM* vm, ArgsView args) {
+            auto _lock = vm->heap.gc_scope_lock();
+            return VAR(set_issubset(set_of(vm, args[1]), _CAST(Set&, args[0])));
+        });
+
+        _vm->bind_method<1>(_vm->_t(type), "isdisjoint", [](VM* vm, ArgsView args) {
+            const Set& self = _CAST(Set&, args[0]);
+            auto _lock = vm->heap.gc_scope_lock();
+            Set other = set_of(vm, args[1]);
+            bool ok = true;
+            self.apply([&](PyObject* k){ if(ok && other.contains(k)) ok = false; });
+            return VAR(ok);
+        });
+
+        _vm->bind_method<0>(_vm->_t(type), "copy", [](VM* vm, ArgsView args) {
+            return set_new(vm, args[0], Set(_CAST(Set&, args[0])));
+        });
+    }
+
+    _vm->bind__hash__(_vm->tp_frozenset, [](VM* vm, PyObject* obj) {
+        // https://github.com/python/cpython/blob/3.11/Objects/setobject.c#L709
+        const Set& self = _CAST(Set&, obj);
+        uint64_t x = 0;
+        self.apply([&](PyObject* k){
+            uint64_t h = (uint64_t)vm->py_hash(k);
+            x ^= ((h ^ 89869747ULL) ^ (h << 16)) * 3644798167ULL;
+        });
+        x ^= ((uint64_t)self.size() + 1) * 1927868237ULL;
+        x ^= (x >> 11) ^ (x >> 25);
+        return (i64)(x * 69069U + 907133923ULL);
+    });
+
+    _vm->bind_method<1>("set", "add", [](VM* vm, ArgsView args) {
+        _CAST(Set&, args[0]).add(args[1]);
+        vm->heap.write_barrier(args[0]);
+        return vm->None;
+    });
+
+    _vm->bind_method<1>("set", "discard", [](VM* vm, ArgsView args) {
+        _CAST(Set&, args[0]).discard(args[1]);
+        return vm->None;
+    });
+
+    _vm->bind_method<1>("set", "remove", [](VM* vm, ArgsView args) {
+        if(!_CAST(Set&, args[0]).discard(args[1])) vm->KeyError(args[1]);
+        return vm->None;
+    });
+
+    _vm->bind_method<0>("set", "pop", [](VM* vm, ArgsView args) {
+        Set& self = _CAST(Set&, args[0]);
+        if(self.size() == 0) vm->_error("KeyError", "pop from an empty set");
+        return self.pop();
+    });
+
+    _vm->bind_method<0>("set", "clear", [](VM* vm, ArgsView args) {
+        _CAST(Set&, args[0]).clear();
+        return vm->None;
+    });
+
+    _vm->bind_method<1>("set", "update", [](VM* vm, ArgsView args) {
+        set_update(vm, _CAST(Set&, args[0]), args[1]);
+        vm->heap.write_barrier(args[0]);
+        return vm->None;
+    });
+
+    _vm->bind_method<1>("set", "difference_update", [](VM* vm, ArgsView args) {
+        Set& self = _CAST(Set&, args[0]);
+        auto _lock = vm->heap.gc_scope_lock();
+        Set other = set_of(vm, args[1]);
+        other.apply([&](PyObject* k){ self.discard(k); });
+        return vm->None;
+    });
+
+    _vm->bind_method<1>("set", "intersection_update", [](VM* vm, ArgsView args) {
+        Set& self = _CAST(Set&, args[0]);
+        auto _lock = vm->heap.gc_scope_lock();
+        Set other = set_of(vm, args[1]);
+        Tuple keys = self.keys();
+        for(PyObject* k: keys) if(!other.contains(k)) self.discard(k);
+        return vm->None;
+    });
+
     _vm->bind__repr__(_vm->tp_module, [](VM* vm, PyObject* obj) {
         const Str& path = CAST(Str&, obj->attr(__path__));
         return VAR(fmt("<module ", path.escape(), ">"));
@@ -1415,7 +2131,12 @@ void init_builtins(VM* _vm) {
     RangeIter::register_class(_vm, _vm->builtins);
     ArrayIter::register_class(_vm, _vm->builtins);
     StringIter::register_class(_vm, _vm->builtins);
-    Generator::register_class(_vm, _vm->builtins);
+    _vm->tp_generator = PK_OBJ_GET(Type, Generator::register_class(_vm, _vm->builtins));
+    MapIter::register_class(_vm, _vm->builtins);
+    FilterIter::register_class(_vm, _vm->builtins);
+    ZipIter::register_class(_vm, _vm->builtins);
+    EnumerateIter::register_class(_vm, _vm->builtins);
+    ReversedIter::register_class(_vm, _vm->builtins);
 }
 
 
@@ -1424,11 +2145,10 @@ void add_module_timeit(VM* vm){
     vm->bind_func<2>(mod, "timeit", [](VM* vm, ArgsView args) {
         PyObject* f = args[0];
         i64 iters = CAST(i64, args[1]);
-        auto now = std::chrono::system_clock::now();
+        auto begin = std::chrono::steady_clock::now();
         for(i64 i=0; i<iters; i++) vm->call(f);
-        auto end = std::chrono::system_clock::now();
-        f64 elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - now).count() / 1000.0;
-        return VAR(elapsed);
+        auto end = std::chrono::steady_clock::now();
+        return VAR(std::chrono::duration<f64>(end - begin).count());
     });
 }
 
@@ -1480,17 +2200,36 @@ void add_module_time(VM* vm){
 
     vm->bind_func<0>(mod, "time", [](VM* vm, ArgsView args) {
         auto now = std::chrono::system_clock::now();
-        return VAR(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() / 1000.0);
+        return VAR(std::chrono::duration<f64>(now.time_since_epoch()).count());
+    });
+
+    // `steady_clock` never goes backwards, unlike the wall clock
+    vm->bind_func<0>(mod, "perf_counter", [](VM* vm, ArgsView args) {
+        auto now = std::chrono::steady_clock::now();
+        return VAR(std::chrono::duration<f64>(now.time_since_epoch()).count());
+    });
+
+    vm->bind_func<0>(mod, "perf_counter_ns", [](VM* vm, ArgsView args) {
+        auto now = std::chrono::steady_clock::now();
+        return VAR((i64)std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+    });
+
+    vm->bind_func<0>(mod, "monotonic", [](VM* vm, ArgsView args) {
+        auto now = std::chrono::steady_clock::now();
+        return VAR(std::chrono::duration<f64>(now.time_since_epoch()).count());
     });
 
+    // blocks the thread instead of spinning, no lock is held meanwhile
     vm->bind_func<1>(mod, "sleep", [](VM* vm, ArgsView args) {
         f64 seconds = CAST_F(args[0]);
-        auto begin = std::chrono::system_clock::now();
-        while(true){
-            auto now = std::chrono::system_clock::now();
-            f64 elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - begin).count() / 1000.0;
-            if(elapsed >= seconds) break;
-        }
+        // NaN fails every comparison, so it would not sleep at all
+        if(std::isnan(seconds)) vm->ValueError("invalid value NaN (not a number)");
+        if(seconds < 0) vm->ValueError("sleep length must be non-negative");
+        // the conversion to the clock's integer ticks must not overflow
+        using Ticks = std::chrono::steady_clock::duration;
+        Ticks limit = Ticks::max() - std::chrono::steady_clock::now().time_since_epoch();
+        if(seconds >= std::chrono::duration<f64>(limit).count()) vm->_error("OverflowError", "sleep length is too large");
+        std::this_thread::sleep_for(std::chrono::duration_cast<Ticks>(std::chrono::duration<f64>(seconds)));
         return vm->None;
     });
 
@@ -1524,19 +2263,6 @@ void add_module_sys(VM* vm){
     });
 }
 
-void add_module_json(VM* vm){
-    PyObject* mod = vm->new_module("json");
-    vm->bind_func<1>(mod, "loads", [](VM* vm, ArgsView args) {
-        const Str& expr = CAST(Str&, args[0]);
-        CodeObject_ code = vm->compile(expr, "<json>", JSON_MODE);
-        return vm->_exec(code, vm->top_frame()->_module);
-    });
-
-    vm->bind_func<1>(mod, "dumps", [](VM* vm, ArgsView args) {
-        return vm->py_json(args[0]);
-    });
-}
-
 
 // https://docs.python.org/3.5/library/math.html
 void add_module_math(VM* vm){
@@ -1655,11 +2381,69 @@ void add_module_dis(VM* vm){
         CodeObject_ code = get_code(vm, args[0]);
         return VAR(code->serialize(vm));
     });
+
+    vm->bind_func<1>(mod, "_ops", [](VM* vm, ArgsView args) {
+        CodeObject_ code = get_code(vm, args[0]);
+        List ops;
+        for(const Bytecode& byte: code->codes) ops.push_back(VAR(OP_NAMES[byte.op]));
+        return VAR(std::move(ops));
+    });
 }
 
 void add_module_gc(VM* vm){
     PyObject* mod = vm->new_module("gc");
-    vm->bind_func<0>(mod, "collect", PK_LAMBDA(VAR(vm->heap.collect())));
+    vm->bind(mod, "collect(generation=1)", [](VM* vm, ArgsView args){
+        int generation = CAST(int, args[0]);
+        if(generation == 0) return VAR(vm->heap.collect_young());
+        return VAR(vm->heap.collect());
+    });
+
+    vm->bind_func<0>(mod, "get_count", [](VM* vm, ArgsView args){
+        return VAR(Tuple({VAR((i64)vm->heap.gen.size()), VAR((i64)vm->heap.old_gen.size())}));
+    });
+
+    vm->bind_func<0>(mod, "get_threshold", [](VM* vm, ArgsView args){
+        return VAR(Tuple({VAR(vm->heap.gc_threshold), VAR(vm->heap.old_threshold)}));
+    });
+
+    vm->bind(mod, "set_threshold(young, old)", [](VM* vm, ArgsView args){
+        int young = CAST(int, args[0]);
+        int old = CAST(int, args[1]);
+        if(young <= 0 || old <= 0) vm->ValueError("threshold must be positive");
+        vm->heap.gc_threshold = young;
+        vm->heap.old_threshold = old;
+        return vm->None;
+    });
+
+    vm->bind_func<0>(mod, "get_stats", [](VM* vm, ArgsView args){
+        List ret;
+        for(const GCStats& stats: vm->heap.stats){
+            Dict d(vm);
+            d.set(VAR("collections"), VAR(stats.collections));
+            d.set(VAR("collected"), VAR(stats.collected));
+            d.set(VAR("pause_total_us"), VAR(stats.pause_total_us));
+            d.set(VAR("pause_max_us"), VAR(stats.pause_max_us));
+            ret.push_back(VAR(std::move(d)));
+        }
+        return VAR(std::move(ret));
+    });
+
+    vm->bind(mod, "set_incremental(budget_us)", [](VM* vm, ArgsView args){
+        int budget_us = CAST(int, args[0]);
+        if(budget_us < 0) vm->ValueError("budget must be non-negative");
+        vm->heap.set_incremental(budget_us);
+        return vm->None;
+    });
+
+    vm->bind_func<0>(mod, "is_incremental", [](VM* vm, ArgsView args){
+        return VAR(vm->heap.incremental());
+    });
+
+    vm->bind(mod, "step(budget_us)", [](VM* vm, ArgsView args){
+        int budget_us = CAST(int, args[0]);
+        if(budget_us < 0) vm->ValueError("budget must be non-negative");
+        return VAR(vm->heap.step(budget_us));
+    });
 }
 
 
@@ -1720,16 +2504,17 @@ void VM::post_init(){
     add_module_random(this);
     add_module_base64(this);
     add_module_timeit(this);
+    add_module_collections(this);
+    add_module_heapq(this);
+    add_module_bisect(this);
 
-    for(const char* name: {"this", "functools", "collections", "heapq", "bisect", "pickle", "_long", "colorsys", "typing", "datetime"}){
+    for(const char* name: {"this", "functools", "collections", "heapq", "bisect", "pickle", "colorsys", "typing", "datetime"}){
         _lazy_modules[name] = kPythonLibs[name];
     }
 
     try{
         CodeObject_ code = compile(kPythonLibs["builtins"], "<builtins>", EXEC_MODE);
         this->_exec(code, this->builtins);
-        code = compile(kPythonLibs["_set"], "<set>", EXEC_MODE);
-        this->_exec(code, this->builtins);
     }catch(Exception& e){
         std::cerr << e.summary() << std::endl;
         std::cerr << "failed to load builtins module!!" << std::endl;
@@ -1740,6 +2525,8 @@ void VM::post_init(){
         add_module_io(this);
         add_module_os(this);
         _import_handler = _default_import_handler;
+        _bytecode_cache_loader = _default_bytecode_cache_loader;
+        _bytecode_cache_writer = _default_bytecode_cache_writer;
     }
 
     add_module_linalg(this);
@@ -2,13 +2,1102 @@
 
 namespace pkpy{
 
+/*************** regex engine ***************/
+// Patterns are compiled into a Thompson NFA. A DFA built lazily from the NFA finds where
+// a match ends, another one built from the reversed NFA finds where it starts, and then
+// the groups are filled in. All of this runs in time linear to the text, whatever the pattern is.
+// Lookaheads are run by the Pike VM, once per position. Backreferences need backtracking,
+// such patterns are run by a backtracker which gives up after `kReMaxSteps` steps.
+// https://swtch.com/~rsc/regexp/regexp3.html
+
+static const uint32_t kReMaxChar = 0x10FFFF;
+static const int kReMaxRepeat = 1000;
+static const int kReMaxDepth = 256;
+static const int kReMaxInsts = 65536;
+static const int kReMaxClasses = 1024;
+static const int64_t kReMaxSteps = 1 << 24;
+
+struct ReRange{ uint32_t lo, hi; };
+using ReClass = std::vector<ReRange>;     // sorted and disjoint ranges of chars
+
+struct ReError{ Str msg; };
+
+static uint32_t _re_decode(const char* p, int n, int* size){
+    unsigned char c = p[0];
+    int k = c < 0x80 ? 1 : utf8len(c, true);
+    // invalid utf8 is read byte by byte
+    if(k < 2 || k > 4 || k > n){ *size = 1; return c; }
+    uint32_t cp = c & (0x7F >> k);
+    for(int i=1; i<k; i++) cp = (cp << 6) | (p[i] & 0x3F);
+    *size = k;
+    return cp;
+}
+
+static bool _re_is_word(char c){
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static void _re_normalize(ReClass& cls){
+    std::sort(cls.begin(), cls.end(), [](const ReRange& a, const ReRange& b){ return a.lo < b.lo; });
+    ReClass out;
+    for(const ReRange& r: cls){
+        if(!out.empty() && r.lo <= out.back().hi + 1){
+            out.back().hi = std::max(out.back().hi, r.hi);
+        }else{
+            out.push_back(r);
+        }
+    }
+    cls = std::move(out);
+}
+
+static ReClass _re_negate(const ReClass& cls){
+    ReClass out;
+    uint32_t next = 0;
+    for(const ReRange& r: cls){
+        if(r.lo > next) out.push_back({next, r.lo - 1});
+        next = r.hi + 1;
+    }
+    if(next <= kReMaxChar) out.push_back({next, kReMaxChar});
+    return out;
+}
+
+static bool _re_contains(const ReClass& cls, uint32_t c){
+    int lo = 0, hi = (int)cls.size() - 1;
+    while(lo <= hi){
+        int mid = (lo + hi) / 2;
+        if(c < cls[mid].lo) hi = mid - 1;
+        else if(c > cls[mid].hi) lo = mid + 1;
+        else return true;
+    }
+    return false;
+}
+
+// `\d`, `\w`, `\s` and their negations, ascii only like std::regex
+static void _re_add_builtin(ReClass& cls, char kind){
+    ReClass ranges;
+    switch(kind){
+        case 'd': case 'D': ranges = {{'0', '9'}}; break;
+        case 'w': case 'W': ranges = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}}; break;
+        case 's': case 'S': ranges = {{'\t', '\r'}, {' ', ' '}}; break;
+    }
+    if(kind >= 'A' && kind <= 'Z') ranges = _re_negate(ranges);
+    cls.insert(cls.end(), ranges.begin(), ranges.end());
+}
+
+struct ReInst{
+    enum Op: uint8_t { CHAR, CLASS, MATCH, SPLIT, JMP, SAVE, BOL, EOL, WORDB, NWORDB, LOOK, BACKREF, MARK, PROGRESS };
+    Op op;
+    // CHAR: the char, CLASS: the class index, SPLIT and JMP: the target, SAVE, MARK and PROGRESS: the slot,
+    // LOOK: the lookahead index, BACKREF: the group index
+    int x;
+    int y;      // SPLIT: the target to try second, PROGRESS: the target if nothing was consumed since MARK
+};
+
+struct ReLook{
+    int start;      // the body, then MATCH
+    bool negated;
+};
+
+struct ReProg{
+    std::vector<ReInst> insts;
+    std::vector<ReClass> classes;
+    int ngroups;            // including the whole match
+    int nslots;             // two for each group, then one for each loop whose body may match empty
+    std::vector<ReLook> looks;
+    bool has_backrefs;
+    int start;              // SAVE 0, the body, SAVE 1, MATCH
+    int start_unanchored;   // a lazy `.*` loop before `start`
+    int start_full;         // like `start`, but the body must end at the end of the text
+    int start_reversed;     // the body backwards, to find where a match starts
+    bool dfa_enabled;       // the DFA does not look behind, so `\b` and `\B` need the Pike VM
+
+    // chars are partitioned into ranges that no instruction tells apart
+    std::vector<uint32_t> bounds;
+    int ascii_classes[128];
+    int nclasses;
+
+    int class_of(uint32_t c) const {
+        if(c < 128) return ascii_classes[c];
+        return std::upper_bound(bounds.begin(), bounds.end(), c) - bounds.begin();
+    }
+
+    bool consumes(const ReInst& inst, uint32_t c) const {
+        if(inst.op == ReInst::CHAR) return (uint32_t)inst.x == c;
+        return inst.op == ReInst::CLASS && _re_contains(classes[inst.x], c);
+    }
+};
+
+struct ReNode{
+    enum Kind: uint8_t { EMPTY, CHAR, CLASS, CAT, ALT, REPEAT, GROUP, ASSERT, LOOK, BACKREF };
+    Kind kind;
+    // CHAR: the char, CLASS: the class index, REPEAT: the min, GROUP: the group index or -1, ASSERT: the opcode,
+    // LOOK: 1 if negated, BACKREF: the group index
+    int x;
+    int y;      // REPEAT: the max, -1 if unbounded
+    bool greedy;
+    std::vector<int> children;
+};
+
+// the ECMAScript syntax of std::regex
+struct ReParser{
+    std::string_view s;
+    int i = 0;
+    int depth = 0;
+    int ngroups = 1;
+    std::vector<ReNode> nodes;
+    std::vector<ReClass> classes;
+
+    ReParser(std::string_view s): s(s) {}
+
+    [[noreturn]] void error(const char* msg){ throw ReError{fmt(msg, " at position ", i)}; }
+
+    bool eof() const { return i >= (int)s.size(); }
+    char peek() const { return s[i]; }
+
+    int node(ReNode::Kind kind, int x=0, int y=0){
+        nodes.push_back({kind, x, y, true, {}});
+        return nodes.size() - 1;
+    }
+
+    int node_class(ReClass&& cls){
+        _re_normalize(cls);
+        classes.push_back(std::move(cls));
+        return node(ReNode::CLASS, classes.size() - 1);
+    }
+
+    int parse(){
+        int root = parse_alt();
+        if(!eof()) error("unbalanced parenthesis");
+        return root;
+    }
+
+    int parse_alt(){
+        int first = parse_cat();
+        if(eof() || peek() != '|') return first;
+        std::vector<int> children = {first};
+        while(!eof() && peek() == '|'){
+            i++;
+            children.push_back(parse_cat());
+        }
+        int k = node(ReNode::ALT);
+        nodes[k].children = std::move(children);
+        return k;
+    }
+
+    int parse_cat(){
+        std::vector<int> children;
+        while(!eof() && peek() != '|' && peek() != ')') children.push_back(parse_repeat());
+        if(children.empty()) return node(ReNode::EMPTY);
+        if(children.size() == 1) return children[0];
+        int k = node(ReNode::CAT);
+        nodes[k].children = std::move(children);
+        return k;
+    }
+
+    // `{m}`, `{m,}` or `{m,n}`, otherwise `{` is a literal
+    bool parse_bounds(int* min, int* max){
+        int j = i + 1;
+        auto number = [&](int* out){
+            int begin = j;
+            int val = 0;
+            while(j < (int)s.size() && s[j] >= '0' && s[j] <= '9'){
+                val = std::min(val * 10 + (s[j] - '0'), kReMaxRepeat + 1);
+                j++;
+            }
+            *out = val;
+            return j > begin;
+        };
+        if(!number(min)) return false;
+        *max = *min;
+        if(j < (int)s.size() && s[j] == ','){
+            j++;
+            if(!number(max)) *max = -1;
+        }
+        if(j >= (int)s.size() || s[j] != '}') return false;
+        if(*min > kReMaxRepeat || *max > kReMaxRepeat) error("the repetition number is too large");
+        if(*max >= 0 && *max < *min) error("min repeat greater than max repeat");
+        i = j + 1;
+        return true;
+    }
+
+    bool parse_quantifier(int* min, int* max){
+        if(eof()) return false;
+        switch(peek()){
+            case '*': i++; *min = 0; *max = -1; return true;
+            case '+': i++; *min = 1; *max = -1; return true;
+            case '?': i++; *min = 0; *max = 1; return true;
+            case '{': return parse_bounds(min, max);
+        }
+        return false;
+    }
+
+    int parse_repeat(){
+        int atom = parse_atom();
+        int min, max;
+        if(!parse_quantifier(&min, &max)) return atom;
+        if(nodes[atom].kind == ReNode::ASSERT || nodes[atom].kind == ReNode::LOOK) error("nothing to repeat");
+        bool greedy = true;
+        if(!eof() && peek() == '?'){ i++; greedy = false; }
+        int m, n;
+        if(parse_quantifier(&m, &n)) error("multiple repeat");
+        int k = node(ReNode::REPEAT, min, max);
+        nodes[k].greedy = greedy;
+        nodes[k].children = {atom};
+        return k;
+    }
+
+    int parse_atom(){
+        switch(peek()){
+            case '(': return parse_group();
+            case '[': return parse_class();
+            case '.': i++; return node_class({{0, '\n' - 1}, {'\n' + 1, kReMaxChar}});
+            case '^': i++; return node(ReNode::ASSERT, ReInst::BOL);
+            case '$': i++; return node(ReNode::ASSERT, ReInst::EOL);
+            case '\\': return parse_escape();
+            case '*': case '+': case '?': error("nothing to repeat");
+            case '{': {
+                int min, max;
+                if(parse_bounds(&min, &max)) error("nothing to repeat");
+                break;
+            }
+        }
+        int size;
+        uint32_t c = _re_decode(s.data() + i, s.size() - i, &size);
+        i += size;
+        return node(ReNode::CHAR, c);
+    }
+
+    int parse_group(){
+        int begin = i++;
+        if(++depth > kReMaxDepth) error("too many nested parentheses");
+        int index = -1;
+        ReNode::Kind kind = ReNode::GROUP;
+        if(!eof() && peek() == '?'){
+            char c = i+1 < (int)s.size() ? s[i+1] : '\0';
+            if(c == '=' || c == '!'){
+                kind = ReNode::LOOK;
+                index = c == '!';
+            }else if(c != ':'){
+                error("unknown extension");
+            }
+            i += 2;
+        }else{
+            index = ngroups++;
+        }
+        int child = parse_alt();
+        if(eof()){ i = begin; error("missing ), unterminated subpattern"); }
+        i++;
+        depth--;
+        int k = node(kind, index);
+        nodes[k].children = {child};
+        return k;
+    }
+
+    int parse_hex(int n){
+        uint32_t c = 0;
+        for(int j=0; j<n; j++){
+            if(eof() || !isxdigit((unsigned char)peek())) error("bad escape");
+            char h = s[i++];
+            c = c * 16 + (h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+        }
+        return c;
+    }
+
+    // returns the escaped char, or -1 if it is a class like `\d` which is added to `cls`
+    int parse_escape_char(ReClass& cls, bool in_class){
+        i++;
+        if(eof()) error("bad escape (end of pattern)");
+        char c = s[i++];
+        switch(c){
+            case 'd': case 'D': case 'w': case 'W': case 's': case 'S':
+                _re_add_builtin(cls, c);
+                return -1;
+            case 'n': return '\n';
+            case 't': return '\t';
+            case 'r': return '\r';
+            case 'f': return '\f';
+            case 'v': return '\v';
+            case '0': return '\0';
+            case 'x': return parse_hex(2);
+            case 'u': return parse_hex(4);
+            case 'b': if(in_class) return '\b'; break;
+        }
+        if(isalnum((unsigned char)c)){ i -= 2; error("bad escape"); }
+        int size;
+        i--;
+        uint32_t ch = _re_decode(s.data() + i, s.size() - i, &size);
+        i += size;
+        return ch;
+    }
+
+    int parse_escape(){
+        if(i+1 < (int)s.size() && (s[i+1] == 'b' || s[i+1] == 'B')){
+            i += 2;
+            return node(ReNode::ASSERT, s[i-1] == 'b' ? ReInst::WORDB : ReInst::NWORDB);
+        }
+        if(i+1 < (int)s.size() && s[i+1] >= '1' && s[i+1] <= '9'){
+            int begin = i++;
+            int index = 0;
+            while(!eof() && peek() >= '0' && peek() <= '9'){
+                index = std::min(index * 10 + (s[i++] - '0'), kReMaxInsts);
+            }
+            if(index >= ngroups){ i = begin; error("invalid group reference"); }
+            return node(ReNode::BACKREF, index);
+        }
+        ReClass cls;
+        int c = parse_escape_char(cls, false);
+        if(c < 0) return node_class(std::move(cls));
+        return node(ReNode::CHAR, c);
+    }
+
+    int parse_class_char(ReClass& cls){
+        if(peek() == '\\') return parse_escape_char(cls, true);
+        int size;
+        uint32_t c = _re_decode(s.data() + i, s.size() - i, &size);
+        i += size;
+        return c;
+    }
+
+    int parse_class(){
+        int begin = i++;
+        bool negated = !eof() && peek() == '^';
+        if(negated) i++;
+        ReClass cls;
+        // `]` is a literal if it comes first
+        for(bool first=true; ; first=false){
+            if(eof()){ i = begin; error("unterminated character set"); }
+            if(peek() == ']' && !first){ i++; break; }
+            int lo = parse_class_char(cls);
+            if(lo < 0) continue;
+            int hi = lo;
+            if(i+1 < (int)s.size() && s[i] == '-' && s[i+1] != ']'){
+                i++;
+                hi = parse_class_char(cls);
+                if(hi < lo) error("bad character range");
+            }
+            cls.push_back({(uint32_t)lo, (uint32_t)hi});
+        }
+        _re_normalize(cls);
+        if(negated) cls = _re_negate(cls);
+        return node_class(std::move(cls));
+    }
+};
+
+struct ReCompiler{
+    ReProg& prog;
+    const std::vector<ReNode>& nodes;
+    std::map<int, int> looks;       // lookahead nodes to their index in `prog.looks`
+    std::vector<int> pending;       // lookahead nodes whose body is not generated yet
+
+    int pc() const { return prog.insts.size(); }
+
+    int emit(ReInst::Op op, int x=0, int y=0){
+        if(pc() >= kReMaxInsts) throw ReError{"the pattern is too large"};
+        prog.insts.push_back({op, x, y});
+        return pc() - 1;
+    }
+
+    void patch_split(int split, int body, int out, bool greedy){
+        prog.insts[split].x = greedy ? body : out;
+        prog.insts[split].y = greedy ? out : body;
+    }
+
+    bool nullable(int k) const {
+        const ReNode& node = nodes[k];
+        switch(node.kind){
+            case ReNode::CHAR: case ReNode::CLASS: return false;
+            case ReNode::CAT:
+                for(int child: node.children) if(!nullable(child)) return false;
+                return true;
+            case ReNode::ALT:
+                for(int child: node.children) if(nullable(child)) return true;
+                return false;
+            case ReNode::REPEAT: return node.x == 0 || nullable(node.children[0]);
+            case ReNode::GROUP: return nullable(node.children[0]);
+            default: return true;
+        }
+    }
+
+    // the bodies are generated after the main programs, each one ends with MATCH
+    void gen_looks(){
+        while(!pending.empty()){
+            int k = pending.back();
+            pending.pop_back();
+            prog.looks[looks[k]].start = pc();
+            gen(nodes[k].children[0], false);
+            emit(ReInst::MATCH);
+        }
+    }
+
+    void gen(int k, bool reversed){
+        const ReNode& node = nodes[k];
+        switch(node.kind){
+            case ReNode::EMPTY: break;
+            case ReNode::CHAR: emit(ReInst::CHAR, node.x); break;
+            case ReNode::CLASS: emit(ReInst::CLASS, node.x); break;
+            case ReNode::CAT:
+                if(reversed){
+                    for(auto it=node.children.rbegin(); it!=node.children.rend(); ++it) gen(*it, true);
+                }else{
+                    for(int child: node.children) gen(child, false);
+                }
+                break;
+            case ReNode::ALT: {
+                std::vector<int> jmps;
+                for(int j=0; j<(int)node.children.size()-1; j++){
+                    int split = emit(ReInst::SPLIT, pc() + 1);
+                    gen(node.children[j], reversed);
+                    jmps.push_back(emit(ReInst::JMP));
+                    prog.insts[split].y = pc();
+                }
+                gen(node.children.back(), reversed);
+                for(int jmp: jmps) prog.insts[jmp].x = pc();
+                break;
+            }
+            case ReNode::GROUP:
+                // the reversed program only finds bounds
+                if(node.x < 0 || reversed){
+                    gen(node.children[0], reversed);
+                    break;
+                }
+                emit(ReInst::SAVE, node.x * 2);
+                gen(node.children[0], false);
+                emit(ReInst::SAVE, node.x * 2 + 1);
+                break;
+            case ReNode::ASSERT: {
+                // `^` and `$` swap when the text is read backwards
+                ReInst::Op op = (ReInst::Op)node.x;
+                if(reversed && op == ReInst::BOL) op = ReInst::EOL;
+                else if(reversed && op == ReInst::EOL) op = ReInst::BOL;
+                emit(op);
+                break;
+            }
+            // only the Pike VM and the backtracker run these, they never read backwards
+            case ReNode::LOOK: {
+                auto it = looks.find(k);
+                if(it == looks.end()){
+                    it = looks.emplace(k, prog.looks.size()).first;
+                    prog.looks.push_back({-1, node.x == 1});
+                    pending.push_back(k);
+                }
+                emit(ReInst::LOOK, it->second);
+                break;
+            }
+            case ReNode::BACKREF: emit(ReInst::BACKREF, node.x); break;
+            case ReNode::REPEAT: {
+                int child = node.children[0];
+                for(int j=0; j<node.x; j++) gen(child, reversed);
+                if(node.y < 0 && !reversed && nullable(child)){
+                    // like python, an iteration which matches the empty string ends the loop.
+                    // Two copies of the body take turns, or the threads of an iteration would
+                    // block the next one which starts at the same place.
+                    int slot = prog.nslots++;
+                    int splits[2], progress[2];
+                    for(int j=0; j<2; j++){
+                        splits[j] = emit(ReInst::SPLIT);
+                        emit(ReInst::MARK, slot);
+                        gen(child, false);
+                        progress[j] = emit(ReInst::PROGRESS, slot);
+                    }
+                    emit(ReInst::JMP, splits[0]);
+                    for(int j=0; j<2; j++){
+                        patch_split(splits[j], splits[j] + 1, pc(), node.greedy);
+                        prog.insts[progress[j]].y = pc();
+                    }
+                }else if(node.y < 0){
+                    int split = emit(ReInst::SPLIT);
+                    gen(child, reversed);
+                    emit(ReInst::JMP, split);
+                    patch_split(split, split + 1, pc(), node.greedy);
+                }else{
+                    // `x{0,2}` is `(x(x)?)?`
+                    bool check = !reversed && nullable(child);
+                    int slot = check ? prog.nslots++ : -1;
+                    std::vector<int> splits, progress;
+                    for(int j=node.x; j<node.y; j++){
+                        splits.push_back(emit(ReInst::SPLIT));
+                        if(check) emit(ReInst::MARK, slot);
+                        gen(child, reversed);
+                        if(check) progress.push_back(emit(ReInst::PROGRESS, slot));
+                    }
+                    for(int split: splits) patch_split(split, split + 1, pc(), node.greedy);
+                    for(int p: progress) prog.insts[p].y = pc();
+                }
+                break;
+            }
+        }
+    }
+};
+
+// throws `ReError` for invalid patterns
+static void _re_compile(std::string_view pattern, ReProg& prog){
+    ReParser parser(pattern);
+    int root = parser.parse();
+    prog.classes = std::move(parser.classes);
+    prog.ngroups = parser.ngroups;
+    prog.nslots = prog.ngroups * 2;
+    prog.classes.push_back({{0, kReMaxChar}});
+
+    ReCompiler c{prog, parser.nodes, {}, {}};
+    prog.start_unanchored = c.emit(ReInst::SPLIT, 3, 1);
+    c.emit(ReInst::CLASS, prog.classes.size() - 1);
+    c.emit(ReInst::JMP, prog.start_unanchored);
+
+    prog.start = c.emit(ReInst::SAVE, 0);
+    c.gen(root, false);
+    c.emit(ReInst::SAVE, 1);
+    c.emit(ReInst::MATCH);
+
+    prog.start_full = c.emit(ReInst::SAVE, 0);
+    c.gen(root, false);
+    c.emit(ReInst::EOL);
+    c.emit(ReInst::SAVE, 1);
+    c.emit(ReInst::MATCH);
+
+    prog.start_reversed = c.pc();
+    c.gen(root, true);
+    c.emit(ReInst::MATCH);
+    c.gen_looks();
+
+    prog.dfa_enabled = true;
+    prog.has_backrefs = false;
+    for(const ReInst& inst: prog.insts){
+        switch(inst.op){
+            case ReInst::WORDB: case ReInst::NWORDB: case ReInst::LOOK: case ReInst::MARK:
+                prog.dfa_enabled = false;
+                break;
+            case ReInst::BACKREF:
+                prog.dfa_enabled = false;
+                prog.has_backrefs = true;
+                break;
+            case ReInst::CHAR:
+                prog.bounds.push_back(inst.x);
+                prog.bounds.push_back(inst.x + 1);
+                break;
+            case ReInst::CLASS:
+                for(const ReRange& r: prog.classes[inst.x]){
+                    prog.bounds.push_back(r.lo);
+                    prog.bounds.push_back(r.hi + 1);
+                }
+                break;
+            default: break;
+        }
+    }
+    std::sort(prog.bounds.begin(), prog.bounds.end());
+    prog.bounds.erase(std::unique(prog.bounds.begin(), prog.bounds.end()), prog.bounds.end());
+    prog.nclasses = prog.bounds.size() + 1;
+    if(prog.nclasses > kReMaxClasses) prog.dfa_enabled = false;
+    for(uint32_t ch=0; ch<128; ch++){
+        prog.ascii_classes[ch] = std::upper_bound(prog.bounds.begin(), prog.bounds.end(), ch) - prog.bounds.begin();
+    }
+}
+
+struct ReLookCache;
+
+// runs the threads of the NFA in lockstep, threads are ordered by priority
+struct RePikeVM{
+    struct Queue{
+        std::vector<int> sparse;
+        std::vector<int> dense;
+        std::vector<int> caps;      // the slots of each thread
+        int size = 0;
+
+        bool contains(int pc) const { int k = sparse[pc]; return k < size && dense[k] == pc; }
+        int insert(int pc){ sparse[pc] = size; dense[size] = pc; return size++; }
+    };
+
+    struct Job{ int pc; int slot; int old; };   // restores `slot` to `old` if `slot` >= 0
+
+    const ReProg* prog = nullptr;
+    ReLookCache* looks = nullptr;
+    int ncap;
+    Queue q0, q1;
+    std::vector<Job> stack;
+    std::vector<int> cap;
+
+    void add(Queue& q, int pc0, int i, int* slots, const char* text, int len){
+        stack.push_back({pc0, -1, 0});
+        while(!stack.empty()){
+            Job job = stack.back();
+            stack.pop_back();
+            if(job.slot >= 0){
+                slots[job.slot] = job.old;
+                continue;
+            }
+            int pc = job.pc;
+            if(q.contains(pc)) continue;
+            int k = q.insert(pc);
+            const ReInst& inst = prog->insts[pc];
+            switch(inst.op){
+                case ReInst::JMP: stack.push_back({inst.x, -1, 0}); break;
+                case ReInst::SPLIT:
+                    stack.push_back({inst.y, -1, 0});
+                    stack.push_back({inst.x, -1, 0});
+                    break;
+                case ReInst::SAVE: case ReInst::MARK:
+                    stack.push_back({0, inst.x, slots[inst.x]});
+                    slots[inst.x] = i;
+                    stack.push_back({pc + 1, -1, 0});
+                    break;
+                case ReInst::PROGRESS: stack.push_back({slots[inst.x] == i ? inst.y : pc + 1, -1, 0}); break;
+                case ReInst::BOL: if(i == 0) stack.push_back({pc + 1, -1, 0}); break;
+                case ReInst::EOL: if(i == len) stack.push_back({pc + 1, -1, 0}); break;
+                case ReInst::WORDB: case ReInst::NWORDB: {
+                    bool a = i > 0 && _re_is_word(text[i-1]);
+                    bool b = i < len && _re_is_word(text[i]);
+                    if((a != b) == (inst.op == ReInst::WORDB)) stack.push_back({pc + 1, -1, 0});
+                    break;
+                }
+                case ReInst::LOOK: add_look(inst.x, pc, i, slots, text, len); break;
+                default:
+                    if((int)q.caps.size() < (k + 1) * ncap) q.caps.resize((k + 1) * ncap);
+                    memcpy(q.caps.data() + k * ncap, slots, ncap * sizeof(int));
+                    break;
+            }
+        }
+    }
+
+    void add_look(int look, int pc, int i, int* slots, const char* text, int len);
+
+    // finds the leftmost first match in `text[pos:]`, an empty match at `forbid` is skipped
+    bool search(const char* text, int len, int pos, int start, bool anchored, int forbid, int* out){
+        if(q0.sparse.empty()){
+            int n = prog->insts.size();
+            ncap = prog->nslots;
+            q0.sparse.resize(n); q0.dense.resize(n);
+            q1.sparse.resize(n); q1.dense.resize(n);
+            cap.resize(ncap);
+        }
+        Queue* clist = &q0;
+        Queue* nlist = &q1;
+        clist->size = 0;
+        bool matched = false;
+        for(int i=pos; ; ){
+            // a thread starting here has the lowest priority
+            if(!matched && (!anchored || i == pos)){
+                std::fill(cap.begin(), cap.end(), -1);
+                add(*clist, start, i, cap.data(), text, len);
+            }
+            if(clist->size == 0) break;
+            uint32_t c = 0;
+            int size = 0;
+            if(i < len) c = _re_decode(text + i, len - i, &size);
+            nlist->size = 0;
+            for(int k=0; k<clist->size; k++){
+                int pc = clist->dense[k];
+                const ReInst& inst = prog->insts[pc];
+                if(inst.op == ReInst::MATCH){
+                    int* tcap = clist->caps.data() + k * ncap;
+                    if(forbid >= 0 && tcap[0] == forbid && tcap[1] == forbid) continue;
+                    memcpy(out, tcap, prog->ngroups * 2 * sizeof(int));
+                    matched = true;
+                    break;      // the threads left have lower priority
+                }
+                if(i < len && prog->consumes(inst, c)){
+                    add(*nlist, pc + 1, i + size, clist->caps.data() + k * ncap, text, len);
+                }
+            }
+            if(i >= len) break;
+            std::swap(clist, nlist);
+            i += size;
+        }
+        return matched;
+    }
+};
+
+// a lookahead is run at most once at each position during a search
+struct ReLookCache{
+    const ReProg* prog = nullptr;
+    std::vector<RePikeVM> vms;      // one for each lookahead
+    std::vector<unsigned> stamps;   // `epoch` where the result is known
+    std::vector<bool> passed;
+    std::vector<int> groups;        // the groups captured by positive lookaheads
+    std::vector<int> empty;
+    unsigned epoch = 0;
+    int width = 0;
+
+    void begin(int len){
+        if(vms.empty()){
+            vms.resize(prog->looks.size());
+            for(RePikeVM& vm: vms){ vm.prog = prog; vm.looks = this; }
+            empty.assign(prog->ngroups * 2, -1);
+        }
+        if(len + 1 > width){
+            width = len + 1;
+            stamps.assign(prog->looks.size() * width, 0);
+            passed.resize(stamps.size());
+            if(prog->ngroups > 1) groups.resize(stamps.size() * prog->ngroups * 2);
+        }
+        if(++epoch == 0){
+            std::fill(stamps.begin(), stamps.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    // returns the groups captured by the lookahead at `i`, or nullptr if it fails
+    const int* eval(int look, const char* text, int len, int i){
+        size_t key = (size_t)look * width + i;
+        int ncap = prog->ngroups * 2;
+        int* out = prog->ngroups > 1 ? groups.data() + key * ncap : empty.data();
+        if(stamps[key] != epoch){
+            stamps[key] = epoch;
+            const ReLook& lk = prog->looks[look];
+            bool ok = vms[look].search(text, len, i, lk.start, true, -1, out);
+            if(!ok || lk.negated) std::fill(out, out + ncap, -1);
+            passed[key] = ok != lk.negated;
+        }
+        return passed[key] ? out : nullptr;
+    }
+};
+
+void RePikeVM::add_look(int look, int pc, int i, int* slots, const char* text, int len){
+    const int* groups = looks->eval(look, text, len, i);
+    if(groups == nullptr) return;
+    // a positive lookahead keeps the groups it captured
+    for(int j=2; j<prog->ngroups*2; j++){
+        if(groups[j] < 0) continue;
+        stack.push_back({0, j, slots[j]});
+        slots[j] = groups[j];
+    }
+    stack.push_back({pc + 1, -1, 0});
+}
+
+// once the bounds of a match are known, a backtracker which never visits the same
+// instruction at the same position twice finds the groups faster than the Pike VM.
+// Without `memo`, it runs patterns with backreferences, until `steps` runs out.
+struct ReBacktracker{
+    static constexpr int kMaxBits = 256 * 1024;
+
+    struct Job{ int pc; int i; int slot; int old; };   // restores `slot` to `old` if `slot` >= 0
+
+    const ReProg* prog = nullptr;
+    bool memo = true;
+    int64_t* steps = nullptr;
+    std::vector<std::unique_ptr<ReBacktracker>> looks;     // one for each lookahead
+    std::vector<uint64_t> visited;
+    std::vector<Job> stack;
+    std::vector<int> cap;
+    std::vector<int> result;
+
+    bool can_run(int begin, int end) const {
+        return (int64_t)prog->insts.size() * (end - begin + 1) <= kMaxBits;
+    }
+
+    ReBacktracker& look(int k){
+        if(looks.empty()) looks.resize(prog->looks.size());
+        if(!looks[k]){
+            looks[k] = std::make_unique<ReBacktracker>();
+            looks[k]->prog = prog;
+            looks[k]->memo = false;
+            looks[k]->result.resize(prog->ngroups * 2);
+        }
+        looks[k]->steps = steps;
+        return *looks[k];
+    }
+
+    // finds the first match in priority order which starts at `begin`, no thread goes past `end`,
+    // an empty match at `forbid` is skipped, the slots start as `init` if it is not nullptr
+    bool run(const char* text, int len, int begin, int end, int start, int forbid, const int* init, int* out){
+        int width = end - begin + 1;
+        if(memo) visited.assign((prog->insts.size() * width + 63) / 64, 0);
+        if(init != nullptr) cap.assign(init, init + prog->nslots);
+        else cap.assign(prog->nslots, -1);
+        stack.clear();
+        stack.push_back({start, begin, -1, 0});
+        while(!stack.empty()){
+            Job job = stack.back();
+            stack.pop_back();
+            if(job.slot >= 0){
+                cap[job.slot] = job.old;
+                continue;
+            }
+            int pc = job.pc;
+            int i = job.i;
+            // follows the thread until it fails, the alternatives are pushed
+            while(true){
+                if(memo){
+                    size_t bit = (size_t)pc * width + (i - begin);
+                    if(visited[bit >> 6] & (1ULL << (bit & 63))) break;
+                    visited[bit >> 6] |= 1ULL << (bit & 63);
+                }else if(--*steps < 0){
+                    throw ReError{"the pattern takes too many steps to match"};
+                }
+                const ReInst& inst = prog->insts[pc];
+                bool ok = true;
+                switch(inst.op){
+                    case ReInst::CHAR: case ReInst::CLASS: {
+                        if(i >= end){ ok = false; break; }
+                        int size;
+                        uint32_t c = _re_decode(text + i, len - i, &size);
+                        ok = prog->consumes(inst, c);
+                        i += size;
+                        pc++;
+                        break;
+                    }
+                    case ReInst::MATCH:
+                        if(forbid >= 0 && cap[0] == forbid && cap[1] == forbid){ ok = false; break; }
+                        memcpy(out, cap.data(), prog->ngroups * 2 * sizeof(int));
+                        stack.clear();
+                        return true;
+                    case ReInst::JMP: pc = inst.x; break;
+                    case ReInst::SPLIT:
+                        stack.push_back({inst.y, i, -1, 0});
+                        pc = inst.x;
+                        break;
+                    case ReInst::SAVE: case ReInst::MARK:
+                        stack.push_back({0, 0, inst.x, cap[inst.x]});
+                        cap[inst.x] = i;
+                        pc++;
+                        break;
+                    case ReInst::PROGRESS: pc = cap[inst.x] == i ? inst.y : pc + 1; break;
+                    case ReInst::BOL: ok = i == 0; pc++; break;
+                    case ReInst::EOL: ok = i == len; pc++; break;
+                    case ReInst::WORDB: case ReInst::NWORDB: {
+                        bool a = i > 0 && _re_is_word(text[i-1]);
+                        bool b = i < len && _re_is_word(text[i]);
+                        ok = (a != b) == (inst.op == ReInst::WORDB);
+                        pc++;
+                        break;
+                    }
+                    case ReInst::BACKREF: {
+                        // like ECMAScript, an unmatched group matches the empty string
+                        int a = cap[inst.x * 2];
+                        int b = cap[inst.x * 2 + 1];
+                        if(a >= 0 && b >= 0){
+                            ok = b - a <= end - i && memcmp(text + a, text + i, b - a) == 0;
+                            i += b - a;
+                        }
+                        pc++;
+                        break;
+                    }
+                    case ReInst::LOOK: {
+                        const ReLook& lk = prog->looks[inst.x];
+                        ReBacktracker& sub = look(inst.x);
+                        bool found = sub.run(text, len, i, len, lk.start, -1, cap.data(), sub.result.data());
+                        ok = found != lk.negated;
+                        // a positive lookahead keeps the groups it captured
+                        if(ok && !lk.negated){
+                            for(int j=2; j<prog->ngroups*2; j++){
+                                if(sub.result[j] == cap[j]) continue;
+                                stack.push_back({0, 0, j, cap[j]});
+                                cap[j] = sub.result[j];
+                            }
+                        }
+                        pc++;
+                        break;
+                    }
+                }
+                if(!ok) break;
+            }
+        }
+        return false;
+    }
+};
+
+// a state is the list of NFA threads after following the empty transitions,
+// states and transitions are built when first needed and flushed when they take too much memory
+struct ReDFA{
+    static constexpr int kUnknown = -1;
+    static constexpr int kDead = -2;
+    static constexpr int kMaxMemory = 1 << 18;
+    static constexpr int kMaxResets = 8;
+
+    const ReProg* prog = nullptr;
+    bool longest;       // keeps the threads after a match, or cuts them as they have lower priority
+
+    std::vector<std::vector<int>> lists;
+    std::vector<bool> matches;
+    std::vector<int> trans;
+    std::map<std::vector<int>, int> index;
+    std::map<std::pair<int, bool>, int> starts;
+    int memory = 0;
+    int resets = 0;
+
+    std::vector<int> stack;
+    std::vector<int> seeds;
+    std::vector<int> list;
+    std::vector<unsigned> seen;
+    unsigned epoch = 0;
+
+    // `$` stays in the list unless `at_end`
+    void closure(const std::vector<int>& from, bool at_start, bool at_end, std::vector<int>& out){
+        out.clear();
+        if(seen.empty()) seen.resize(prog->insts.size());
+        if(++epoch == 0){
+            std::fill(seen.begin(), seen.end(), 0);
+            epoch = 1;
+        }
+        for(int seed: from){
+            stack.push_back(seed);
+            while(!stack.empty()){
+                int pc = stack.back();
+                stack.pop_back();
+                if(seen[pc] == epoch) continue;
+                seen[pc] = epoch;
+                const ReInst& inst = prog->insts[pc];
+                switch(inst.op){
+                    case ReInst::JMP: stack.push_back(inst.x); break;
+                    case ReInst::SPLIT: stack.push_back(inst.y); stack.push_back(inst.x); break;
+                    case ReInst::SAVE: stack.push_back(pc + 1); break;
+                    case ReInst::BOL: if(at_start) stack.push_back(pc + 1); break;
+                    case ReInst::EOL:
+                        if(at_end) stack.push_back(pc + 1);
+                        else out.push_back(pc);
+                        break;
+                    case ReInst::MATCH:
+                        out.push_back(pc);
+                        if(!longest){
+                            stack.clear();
+                            return;
+                        }
+                        break;
+                    default: out.push_back(pc); break;
+                }
+            }
+        }
+        if(longest) std::sort(out.begin(), out.end());
+    }
+
+    int add_state(const std::vector<int>& l){
+        if(l.empty()) return kDead;
+        auto it = index.find(l);
+        if(it != index.end()) return it->second;
+        int id = lists.size();
+        bool m = false;
+        for(int pc: l) m |= prog->insts[pc].op == ReInst::MATCH;
+        memory += (l.size() * 2 + prog->nclasses) * sizeof(int) + 64;
+        lists.push_back(l);
+        matches.push_back(m);
+        index.emplace(l, id);
+        trans.resize(trans.size() + prog->nclasses, kUnknown);
+        return id;
+    }
+
+    void reset(){
+        lists.clear();
+        matches.clear();
+        trans.clear();
+        index.clear();
+        starts.clear();
+        memory = 0;
+        resets++;
+    }
+
+    int start_state(int pc, bool at_start){
+        auto key = std::make_pair(pc, at_start);
+        auto it = starts.find(key);
+        if(it != starts.end()) return it->second;
+        if(memory > kMaxMemory) reset();
+        seeds.assign(1, pc);
+        closure(seeds, at_start, false, list);
+        int s = add_state(list);
+        starts[key] = s;
+        return s;
+    }
+
+    int next(int s, int cls){
+        int t = trans[s * prog->nclasses + cls];
+        if(t != kUnknown) return t;
+        uint32_t c = cls == 0 ? 0 : prog->bounds[cls - 1];
+        seeds.clear();
+        for(int pc: lists[s]){
+            if(prog->consumes(prog->insts[pc], c)) seeds.push_back(pc + 1);
+        }
+        closure(seeds, false, false, list);
+        if(memory > kMaxMemory){
+            std::vector<int> current = lists[s];
+            reset();
+            s = add_state(current);
+        }
+        t = add_state(list);
+        trans[s * prog->nclasses + cls] = t;
+        return t;
+    }
+
+    bool matches_at_end(int s, bool at_start){
+        std::vector<int> from = lists[s];
+        closure(from, at_start, true, list);
+        for(int pc: list) if(prog->insts[pc].op == ReInst::MATCH) return true;
+        return false;
+    }
+
+    // returns the end of the match in `text[pos:]`, -1 if there is none,
+    // or -2 if the cache thrashes and the Pike VM should be used instead
+    int run_forward(int start, const char* text, int len, int pos){
+        resets = 0;
+        int s = start_state(start, pos == 0);
+        if(s == kDead) return -1;
+        int last = matches[s] ? pos : -1;
+        int i = pos;
+        while(i < len){
+            // nothing but the match is left
+            if(matches[s] && lists[s].size() == 1) return last;
+            int size = 1;
+            uint32_t c = (unsigned char)text[i];
+            if(c >= 0x80) c = _re_decode(text + i, len - i, &size);
+            int t = next(s, prog->class_of(c));
+            if(resets > kMaxResets) return -2;
+            if(t == kDead) return last;
+            s = t;
+            i += size;
+            if(matches[s]) last = i;
+        }
+        if(matches_at_end(s, i == 0)) last = len;
+        return last;
+    }
+
+    // returns the start of the longest match in `text[pos:end]` which ends at `end`,
+    // the text is read backwards, `^` and `$` are swapped in the reversed program
+    int run_backward(int start, const char* text, int len, int end, int pos){
+        resets = 0;
+        int s = start_state(start, end == len);
+        if(s == kDead) return -1;
+        int last = matches[s] ? end : -1;
+        int i = end;
+        while(i > pos){
+            int j = i - 1;
+            while(j > pos && ((unsigned char)text[j] & 0xC0) == 0x80) j--;
+            int size;
+            uint32_t c = _re_decode(text + j, i - j, &size);
+            if(j + size != i){ j = i - 1; c = (unsigned char)text[j]; }
+            int t = next(s, prog->class_of(c));
+            if(resets > kMaxResets) return -2;
+            if(t == kDead) return last;
+            s = t;
+            i = j;
+            if(matches[s]) last = i;
+        }
+        if(pos == 0 && matches_at_end(s, end == len && i == end)) last = 0;
+        return last;
+    }
+};
+
+/*************** re module ***************/
+enum class ReMode { SEARCH, MATCH, FULLMATCH };
+
 struct ReMatch {
     PY_CLASS(ReMatch, re, Match)
 
+    PyObject* string;
+    std::vector<int> caps;  // byte offsets of the bounds of each group, -1 if unmatched
     i64 start;
     i64 end;
-    std::cmatch m;
-    ReMatch(i64 start, i64 end, std::cmatch m) : start(start), end(end), m(m) {}
+
+    ReMatch(PyObject* string, const std::vector<int>& caps) : string(string), caps(caps) {
+        const Str& s = PK_OBJ_GET(Str, string);
+        start = s._byte_index_to_unicode(caps[0]);
+        end = s._byte_index_to_unicode(caps[1]);
+    }
+
+    int size() const { return caps.size() / 2; }
+
+    PyObject* group(VM* vm, int index) const {
+        if(caps[index*2] < 0) return vm->None;
+        const Str& s = PK_OBJ_GET(Str, string);
+        return VAR(std::string_view(s.data + caps[index*2], caps[index*2+1] - caps[index*2]));
+    }
+
+    void _gc_mark() const { PK_OBJ_MARK(string); }
 
     static void _register(VM* vm, PyObject* mod, PyObject* type){
         vm->bind_notimplemented_constructor<ReMatch>(type);
@@ -20,63 +1109,345 @@ struct ReMatch {
             return VAR(Tuple({VAR(self.start), VAR(self.end)}));
         });
 
-        vm->bind_method<1>(type, "group", [](VM* vm, ArgsView args) {
+        vm->bind(type, "group(self, index=0)", [](VM* vm, ArgsView args) {
             auto& self = _CAST(ReMatch&, args[0]);
             int index = CAST(int, args[1]);
-            index = vm->normalized_index(index, self.m.size());
-            return VAR(self.m[index].str());
+            index = vm->normalized_index(index, self.size());
+            return self.group(vm, index);
+        });
+
+        vm->bind_method<0>(type, "groups", [](VM* vm, ArgsView args) {
+            auto& self = _CAST(ReMatch&, args[0]);
+            Tuple t(self.size() - 1);
+            for(int i=1; i<self.size(); i++) t[i-1] = self.group(vm, i);
+            return VAR(std::move(t));
         });
     }
 };
 
-static PyObject* _regex_search(const Str& pattern, const Str& string, bool from_start, VM* vm){
-    std::regex re(pattern.begin(), pattern.end());
-    std::cmatch m;
-    if(std::regex_search(string.begin(), string.end(), m, re)){
-        if(from_start && m.position() != 0) return vm->None;
-        i64 start = string._byte_index_to_unicode(m.position());
-        i64 end = string._byte_index_to_unicode(m.position() + m.length());
-        return VAR_T(ReMatch, start, end, m);
+struct RePattern {
+    PY_CLASS(RePattern, re, Pattern)
+
+    Str pattern;
+    ReProg prog;
+    RePikeVM pike;
+    ReBacktracker backtracker;
+    ReLookCache look_cache;
+    ReDFA dfa;      // finds the end of a match
+    ReDFA rdfa;     // finds the start of a match
+
+    RePattern(const Str& pattern, ReProg&& prog) : pattern(pattern), prog(std::move(prog)) {
+        pike.prog = backtracker.prog = look_cache.prog = dfa.prog = rdfa.prog = &this->prog;
+        pike.looks = &look_cache;
+        backtracker.memo = !this->prog.has_backrefs;
+        dfa.longest = false;
+        rdfa.longest = true;
     }
-    return vm->None;
+
+    bool search(VM* vm, const Str& s, int pos, ReMode mode, int forbid, std::vector<int>& caps);
+    bool _search_backrefs(const Str& s, int pos, ReMode mode, int forbid, std::vector<int>& caps);
+
+    static void _register(VM* vm, PyObject* mod, PyObject* type);
 };
 
+// finds the leftmost first match from the byte offset `pos`, an empty match at `forbid` is skipped
+bool RePattern::search(VM* vm, const Str& s, int pos, ReMode mode, int forbid, std::vector<int>& caps){
+    caps.assign(prog.ngroups * 2, -1);
+    if(prog.has_backrefs){
+        try{
+            return _search_backrefs(s, pos, mode, forbid, caps);
+        }catch(ReError& e){
+            vm->_error("RuntimeError", fmt("regex ", pattern.escape(), ": ", e.msg));
+        }
+    }
+    if(!prog.looks.empty()) look_cache.begin(s.size);
+    int start = mode == ReMode::FULLMATCH ? prog.start_full : prog.start;
+    if(prog.dfa_enabled && forbid < 0){
+        int end = dfa.run_forward(mode == ReMode::SEARCH ? prog.start_unanchored : start, s.data, s.size, pos);
+        if(end == -1) return false;
+        if(end >= 0){
+            int begin = pos;
+            if(mode == ReMode::SEARCH) begin = rdfa.run_backward(prog.start_reversed, s.data, s.size, end, pos);
+            if(begin >= 0){
+                if(prog.ngroups == 1){
+                    caps[0] = begin;
+                    caps[1] = end;
+                    return true;
+                }
+                if(backtracker.can_run(begin, end)){
+                    return backtracker.run(s.data, s.size, begin, end, start, -1, nullptr, caps.data());
+                }
+                return pike.search(s.data, s.size, begin, start, true, -1, caps.data());
+            }
+        }
+    }
+    return pike.search(s.data, s.size, pos, start, mode != ReMode::SEARCH, forbid, caps.data());
+}
+
+// tries each start position in turn, the steps are counted over all of them
+bool RePattern::_search_backrefs(const Str& s, int pos, ReMode mode, int forbid, std::vector<int>& caps){
+    int64_t steps = kReMaxSteps;
+    backtracker.steps = &steps;
+    int start = mode == ReMode::FULLMATCH ? prog.start_full : prog.start;
+    for(int i=pos; i<=s.size; ){
+        if(backtracker.run(s.data, s.size, i, s.size, start, forbid, nullptr, caps.data())) return true;
+        if(mode != ReMode::SEARCH || i == s.size) break;
+        int size;
+        _re_decode(s.data + i, s.size - i, &size);
+        i += size;
+    }
+    return false;
+}
+
+// compiled patterns are cached in `re._cache`, the first entry is the least recently used
+static const int kReCacheSize = 512;
+
+// `re._cache` is visible to python code, so it is replaced if it is not a dict
+static PyObject* _regex_cache(VM* vm){
+    PyObject* mod = vm->_modules["re"];
+    PyObject* cache_obj = mod->attr().try_get("_cache");
+    if(cache_obj == nullptr || !is_non_tagged_type(cache_obj, vm->tp_dict)){
+        cache_obj = VAR(Dict(vm));
+        mod->attr().set("_cache", cache_obj);
+        vm->heap.write_barrier(mod);
+    }
+    return cache_obj;
+}
+
+static PyObject* _regex_compile(VM* vm, PyObject* pattern){
+    if(is_non_tagged_type(pattern, RePattern::_type(vm))) return pattern;
+    const Str& s = CAST(Str&, pattern);
+    PyObject* cache_obj = _regex_cache(vm);
+    Dict& cache = PK_OBJ_GET(Dict, cache_obj);
+    PyObject* cached = cache.try_get(pattern);
+    // entries put there by python code are not trusted
+    if(cached != nullptr && !is_non_tagged_type(cached, RePattern::_type(vm))){
+        cache.erase(pattern);
+        cached = nullptr;
+    }
+    if(cached != nullptr){
+        if(cache._items[cache._items_len-1].second != cached){
+            cache.erase(pattern);
+            cache.set(pattern, cached);
+            vm->heap.write_barrier(cache_obj);
+        }
+        return cached;
+    }
+    PyObject* obj = nullptr;
+    try{
+        ReProg prog;
+        _re_compile(s.sv(), prog);
+        obj = VAR_T(RePattern, s, std::move(prog));
+    }catch(ReError& e){
+        vm->ValueError(fmt("invalid regex ", s.escape(), ": ", e.msg));
+    }
+    if(cache.size() >= kReCacheSize){
+        for(int i=0; i<cache._items_len; i++){
+            if(cache._items[i].first == nullptr) continue;
+            cache.erase(cache._items[i].first);
+            break;
+        }
+    }
+    cache.set(pattern, obj);
+    vm->heap.write_barrier(cache_obj);
+    return obj;
+}
+
+static PyObject* _regex_search(VM* vm, RePattern& self, PyObject* string, int pos, ReMode mode){
+    const Str& s = CAST(Str&, string);
+    if(pos < 0) pos = 0;
+    if(pos > s.u8_length()) return vm->None;
+    std::vector<int> caps;
+    if(!self.search(vm, s, s._unicode_index_to_byte(pos), mode, -1, caps)) return vm->None;
+    return VAR_T(ReMatch, string, caps);
+}
+
+// calls `f(caps)` for each non-overlapping match, at most `count` times if it is positive
+template<typename F>
+static void _regex_iterate(VM* vm, RePattern& self, const Str& s, int count, F f){
+    std::vector<int> caps;
+    int pos = 0;
+    int forbid = -1;
+    for(int n=0; count <= 0 || n < count; n++){
+        if(!self.search(vm, s, pos, ReMode::SEARCH, forbid, caps)) break;
+        f(caps);
+        pos = caps[1];
+        // an empty match must not be found at the same place again
+        forbid = caps[0] == caps[1] ? pos : -1;
+    }
+}
+
+// appends `repl` with `$&`, `$n`, `$nn`, `` $` `` and `$'` replaced like ECMAScript
+static void _regex_expand(std::string& out, const Str& repl, const Str& s, const std::vector<int>& caps){
+    int ngroups = caps.size() / 2;
+    auto group = [&](int i){
+        if(caps[i*2] >= 0) out.append(s.data + caps[i*2], caps[i*2+1] - caps[i*2]);
+    };
+    const char* p = repl.data;
+    for(int i=0; i<repl.size; i++){
+        if(p[i] != '$' || i+1 == repl.size){
+            out += p[i];
+            continue;
+        }
+        char c = p[++i];
+        if(c == '$') out += '$';
+        else if(c == '&') group(0);
+        else if(c == '`') out.append(s.data, caps[0]);
+        else if(c == '\'') out.append(s.data + caps[1], s.size - caps[1]);
+        else if(c >= '0' && c <= '9'){
+            int k = c - '0';
+            if(i+1 < repl.size && p[i+1] >= '0' && p[i+1] <= '9' && k*10 + (p[i+1] - '0') < ngroups){
+                k = k*10 + (p[++i] - '0');
+            }
+            if(k < ngroups) group(k);
+        }else{
+            out += '$';
+            out += c;
+        }
+    }
+}
+
+static PyObject* _regex_sub(VM* vm, RePattern& self, const Str& repl, const Str& s, int count){
+    std::string out;
+    int last = 0;
+    _regex_iterate(vm, self, s, count, [&](const std::vector<int>& caps){
+        out.append(s.data + last, caps[0] - last);
+        _regex_expand(out, repl, s, caps);
+        last = caps[1];
+    });
+    out.append(s.data + last, s.size - last);
+    return VAR(std::move(out));
+}
+
+// this is different from cpython, the last empty string is not included
+static PyObject* _regex_split(VM* vm, RePattern& self, const Str& s){
+    List vec;
+    int last = 0;
+    _regex_iterate(vm, self, s, 0, [&](const std::vector<int>& caps){
+        vec.push_back(VAR(std::string_view(s.data + last, caps[0] - last)));
+        last = caps[1];
+    });
+    if(last < s.size) vec.push_back(VAR(std::string_view(s.data + last, s.size - last)));
+    return VAR(std::move(vec));
+}
+
+static PyObject* _regex_findall(VM* vm, RePattern& self, const Str& s){
+    List vec;
+    _regex_iterate(vm, self, s, 0, [&](const std::vector<int>& caps){
+        int ngroups = caps.size() / 2;
+        auto group = [&](int i){
+            if(caps[i*2] < 0) return VAR("");
+            return VAR(std::string_view(s.data + caps[i*2], caps[i*2+1] - caps[i*2]));
+        };
+        // the whole match without groups, the only group, or a tuple of all groups
+        if(ngroups <= 2){
+            vec.push_back(group(ngroups - 1));
+        }else{
+            Tuple t(ngroups - 1);
+            for(int i=1; i<ngroups; i++) t[i-1] = group(i);
+            vec.push_back(VAR(std::move(t)));
+        }
+    });
+    return VAR(std::move(vec));
+}
+
+static PyObject* _regex_finditer(VM* vm, RePattern& self, PyObject* string){
+    List vec;
+    _regex_iterate(vm, self, CAST(Str&, string), 0, [&](const std::vector<int>& caps){
+        vec.push_back(VAR_T(ReMatch, string, caps));
+    });
+    return vm->py_iter(VAR(std::move(vec)));
+}
+
+void RePattern::_register(VM* vm, PyObject* mod, PyObject* type){
+    vm->bind_notimplemented_constructor<RePattern>(type);
+
+    vm->bind_property(type, "pattern", [](VM* vm, ArgsView args) {
+        return VAR(_CAST(RePattern&, args[0]).pattern);
+    });
+
+    vm->bind__repr__(PK_OBJ_GET(Type, type), [](VM* vm, PyObject* obj) {
+        return VAR(fmt("re.compile(", _CAST(RePattern&, obj).pattern.escape(true), ")"));
+    });
+
+    vm->bind(type, "match(self, string, pos=0)", [](VM* vm, ArgsView args) {
+        return _regex_search(vm, _CAST(RePattern&, args[0]), args[1], CAST(int, args[2]), ReMode::MATCH);
+    });
+
+    vm->bind(type, "search(self, string, pos=0)", [](VM* vm, ArgsView args) {
+        return _regex_search(vm, _CAST(RePattern&, args[0]), args[1], CAST(int, args[2]), ReMode::SEARCH);
+    });
+
+    vm->bind(type, "fullmatch(self, string, pos=0)", [](VM* vm, ArgsView args) {
+        return _regex_search(vm, _CAST(RePattern&, args[0]), args[1], CAST(int, args[2]), ReMode::FULLMATCH);
+    });
+
+    vm->bind(type, "sub(self, repl, string, count=0)", [](VM* vm, ArgsView args) {
+        return _regex_sub(vm, _CAST(RePattern&, args[0]), CAST(Str&, args[1]), CAST(Str&, args[2]), CAST(int, args[3]));
+    });
+
+    vm->bind_method<1>(type, "split", [](VM* vm, ArgsView args) {
+        return _regex_split(vm, _CAST(RePattern&, args[0]), CAST(Str&, args[1]));
+    });
+
+    vm->bind_method<1>(type, "findall", [](VM* vm, ArgsView args) {
+        return _regex_findall(vm, _CAST(RePattern&, args[0]), CAST(Str&, args[1]));
+    });
+
+    vm->bind_method<1>(type, "finditer", [](VM* vm, ArgsView args) {
+        return _regex_finditer(vm, _CAST(RePattern&, args[0]), args[1]);
+    });
+}
+
 void add_module_re(VM* vm){
     PyObject* mod = vm->new_module("re");
     ReMatch::register_class(vm, mod);
+    RePattern::register_class(vm, mod);
+    mod->attr().set("_cache", VAR(Dict(vm)));
+
+    vm->bind_func<1>(mod, "compile", [](VM* vm, ArgsView args) {
+        return _regex_compile(vm, args[0]);
+    });
+
+    vm->bind_func<0>(mod, "purge", [](VM* vm, ArgsView args) {
+        PK_OBJ_GET(Dict, _regex_cache(vm)).clear();
+        return vm->None;
+    });
 
     vm->bind_func<2>(mod, "match", [](VM* vm, ArgsView args) {
-        const Str& pattern = CAST(Str&, args[0]);
-        const Str& string = CAST(Str&, args[1]);
-        return _regex_search(pattern, string, true, vm);
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_search(vm, self, args[1], 0, ReMode::MATCH);
     });
 
     vm->bind_func<2>(mod, "search", [](VM* vm, ArgsView args) {
-        const Str& pattern = CAST(Str&, args[0]);
-        const Str& string = CAST(Str&, args[1]);
-        return _regex_search(pattern, string, false, vm);
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_search(vm, self, args[1], 0, ReMode::SEARCH);
+    });
+
+    vm->bind_func<2>(mod, "fullmatch", [](VM* vm, ArgsView args) {
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_search(vm, self, args[1], 0, ReMode::FULLMATCH);
     });
 
-    vm->bind_func<3>(mod, "sub", [](VM* vm, ArgsView args) {
-        const Str& pattern = CAST(Str&, args[0]);
-        const Str& repl = CAST(Str&, args[1]);
-        const Str& string = CAST(Str&, args[2]);
-        std::regex re(pattern.begin(), pattern.end());
-        return VAR(std::regex_replace(string.str(), re, repl.str()));
+    vm->bind(mod, "sub(pattern, repl, string, count=0)", [](VM* vm, ArgsView args) {
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_sub(vm, self, CAST(Str&, args[1]), CAST(Str&, args[2]), CAST(int, args[3]));
     });
 
     vm->bind_func<2>(mod, "split", [](VM* vm, ArgsView args) {
-        const Str& pattern = CAST(Str&, args[0]);
-        const Str& string = CAST(Str&, args[1]);
-        std::regex re(pattern.begin(), pattern.end());
-        std::cregex_token_iterator it(string.begin(), string.end(), re, -1);
-        std::cregex_token_iterator end;
-        List vec;
-        for(; it != end; ++it){
-            vec.push_back(VAR(it->str()));
-        }
-        return VAR(vec);
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_split(vm, self, CAST(Str&, args[1]));
+    });
+
+    vm->bind_func<2>(mod, "findall", [](VM* vm, ArgsView args) {
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_findall(vm, self, CAST(Str&, args[1]));
+    });
+
+    vm->bind_func<2>(mod, "finditer", [](VM* vm, ArgsView args) {
+        RePattern& self = _CAST(RePattern&, _regex_compile(vm, args[0]));
+        return _regex_finditer(vm, self, args[1]);
     });
 }
 
-}   // namespace pkpy
\ No newline at end of file
+}   // namespace pkpy
@@ -13,6 +13,75 @@ int utf8len(unsigned char c, bool suppress){
     return 0;
 }
 
+// https://github.com/wangyi-fudan/wyhash (final version 4)
+static inline void _wymum(uint64_t* a, uint64_t* b){
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = *a;
+    r *= *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static inline uint64_t _wymix(uint64_t a, uint64_t b){ _wymum(&a, &b); return a ^ b; }
+static inline uint64_t _wyr8(const uint8_t* p){ uint64_t v; memcpy(&v, p, 8); return v; }
+static inline uint64_t _wyr4(const uint8_t* p){ uint32_t v; memcpy(&v, p, 4); return v; }
+static inline uint64_t _wyr3(const uint8_t* p, size_t k){
+    return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+}
+
+uint64_t wyhash(const void* key, size_t len){
+    static const uint64_t secret[4] = {
+        0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+    };
+    const uint8_t* p = (const uint8_t*)key;
+    uint64_t seed = _wymix(secret[0], secret[1]);
+    uint64_t a, b;
+    if(len <= 16){
+        if(len >= 4){
+            a = (_wyr4(p) << 32) | _wyr4(p + ((len >> 3) << 2));
+            b = (_wyr4(p + len - 4) << 32) | _wyr4(p + len - 4 - ((len >> 3) << 2));
+        }else if(len > 0){
+            a = _wyr3(p, len);
+            b = 0;
+        }else{
+            a = b = 0;
+        }
+    }else{
+        size_t i = len;
+        if(i > 48){
+            uint64_t see1 = seed, see2 = seed;
+            do{
+                seed = _wymix(_wyr8(p) ^ secret[1], _wyr8(p + 8) ^ seed);
+                see1 = _wymix(_wyr8(p + 16) ^ secret[2], _wyr8(p + 24) ^ see1);
+                see2 = _wymix(_wyr8(p + 32) ^ secret[3], _wyr8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            }while(i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while(i > 16){
+            seed = _wymix(_wyr8(p) ^ secret[1], _wyr8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = _wyr8(p + i - 16);
+        b = _wyr8(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    _wymum(&a, &b);
+    return _wymix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
     Str::Str(int size, bool is_ascii): size(size), is_ascii(is_ascii) {
         _alloc();
     }
@@ -42,12 +111,12 @@ int utf8len(unsigned char c, bool suppress){
 
 #undef STR_INIT
 
-    Str::Str(const Str& other): size(other.size), is_ascii(other.is_ascii) {
+    Str::Str(const Str& other): size(other.size), is_ascii(other.is_ascii), _cached_hash(other._cached_hash) {
         _alloc();
         memcpy(data, other.data, size);
     }
 
-    Str::Str(Str&& other): size(other.size), is_ascii(other.is_ascii) {
+    Str::Str(Str&& other): size(other.size), is_ascii(other.is_ascii), _cached_hash(other._cached_hash) {
         if(other.is_inlined()){
             data = _inlined;
             for(int i=0; i<size; i++) _inlined[i] = other._inlined[i];
@@ -55,6 +124,7 @@ int utf8len(unsigned char c, bool suppress){
             data = other.data;
             other.data = other._inlined;
             other.size = 0;
+            other._cached_hash = 0;
         }
     }
 
@@ -84,11 +154,17 @@ int utf8len(unsigned char c, bool suppress){
         size = other.size;
         is_ascii = other.is_ascii;
         _cached_c_str = nullptr;
+        _cached_hash = other._cached_hash;
         _alloc();
         memcpy(data, other.data, size);
         return *this;
     }
 
+    size_t Str::_compute_hash() const{
+        size_t h = (size_t)wyhash(data, size);
+        return h == 0 ? 1 : h;
+    }
+
     Str Str::operator+(const Str& other) const {
         Str ret(size + other.size, is_ascii && other.is_ascii);
         memcpy(ret.data, data, size);
@@ -355,45 +431,144 @@ int utf8len(unsigned char c, bool suppress){
         return os << sn.sv();
     }
 
-    std::map<std::string, uint16_t, std::less<>>& StrName::_interned(){
-        static std::map<std::string, uint16_t, std::less<>> interned;
-        return interned;
-    }
+    // Interned names are never freed, so the tables below only grow and
+    // readers never wait on writers.
+    // A name is found by walking a hash trie, 4 bits of its hash per level.
+    // New names are published with a single CAS, so racing threads agree on
+    // one index per name; a loser's entry is left unused in the index table.
+    struct InternedName{
+        std::string str;
+        uint64_t hash;
+        uint32_t index;
+        std::atomic<InternedName*> next;    // names with the same full hash
+        InternedName(std::string_view s, uint64_t hash, uint32_t index): str(s), hash(hash), index(index), next(nullptr) {}
+    };
+
+    struct InternTrieNode{
+        // a slot holds an `InternedName*`, or an `InternTrieNode*` tagged with bit 0
+        std::atomic<uintptr_t> slots[16];
+        InternTrieNode(){ for(auto& slot: slots) slot.store(0, std::memory_order_relaxed); }
+    };
+
+    struct InternTable{
+        // chunk `c` holds `kChunk0 << c` names, enough for every 32-bit index
+        static constexpr uint32_t kChunk0 = 1024;
+        static constexpr int kNumChunks = 23;
+
+        InternTrieNode root;
+        std::atomic<uint32_t> count;
+        std::atomic<std::atomic<InternedName*>*> chunks[kNumChunks];
+
+        InternTable(): count(0) {
+            for(auto& chunk: chunks) chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        static int chunk_of(uint32_t i, uint32_t* offset){
+            uint32_t q = i / kChunk0 + 1;
+            int c = 0;
+            while(q >>= 1) c++;
+            *offset = i - kChunk0 * ((1u << c) - 1);
+            return c;
+        }
+
+        std::atomic<InternedName*>* chunk(int c){
+            std::atomic<InternedName*>* p = chunks[c].load(std::memory_order_acquire);
+            if(p != nullptr) return p;
+            uint32_t size = kChunk0 << c;
+            std::atomic<InternedName*>* fresh = new std::atomic<InternedName*>[size];
+            for(uint32_t i=0; i<size; i++) fresh[i].store(nullptr, std::memory_order_relaxed);
+            if(chunks[c].compare_exchange_strong(p, fresh, std::memory_order_acq_rel)) return fresh;
+            delete[] fresh;
+            return p;
+        }
+
+        InternedName* at(uint32_t index){
+            uint32_t offset;
+            int c = chunk_of(index - 1, &offset);
+            std::atomic<InternedName*>* p = chunks[c].load(std::memory_order_acquire);
+            if(p == nullptr) return nullptr;
+            return p[offset].load(std::memory_order_acquire);
+        }
+
+        InternedName* new_name(std::string_view s, uint64_t hash){
+            uint32_t index = count.fetch_add(1, std::memory_order_relaxed) + 1;
+            if(index == 0) throw std::runtime_error("too many interned names");
+            InternedName* name = new InternedName(s, hash, index);
+            uint32_t offset;
+            int c = chunk_of(index - 1, &offset);
+            chunk(c)[offset].store(name, std::memory_order_release);
+            return name;
+        }
+
+        InternedName* intern(std::string_view s){
+            uint64_t hash = wyhash(s.data(), s.size());
+            InternTrieNode* node = &root;
+            int shift = 0;
+            InternedName* fresh = nullptr;
+            while(true){
+                std::atomic<uintptr_t>& slot = node->slots[(hash >> shift) & 15];
+                uintptr_t v = slot.load(std::memory_order_acquire);
+                if(v == 0){
+                    if(fresh == nullptr) fresh = new_name(s, hash);
+                    if(slot.compare_exchange_strong(v, (uintptr_t)fresh, std::memory_order_acq_rel)) return fresh;
+                    continue;
+                }
+                if(v & 1){
+                    node = (InternTrieNode*)(v & ~(uintptr_t)1);
+                    shift += 4;
+                    continue;
+                }
+                InternedName* p = (InternedName*)v;
+                if(p->hash == hash){
+                    while(true){
+                        if(p->str == s) return p;
+                        InternedName* next = p->next.load(std::memory_order_acquire);
+                        if(next == nullptr){
+                            if(fresh == nullptr) fresh = new_name(s, hash);
+                            if(p->next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel)) return fresh;
+                        }
+                        p = next;
+                    }
+                }
+                // two hashes share this slot, push the old one a level down
+                InternTrieNode* child = new InternTrieNode();
+                child->slots[(p->hash >> (shift + 4)) & 15].store(v, std::memory_order_relaxed);
+                if(!slot.compare_exchange_strong(v, (uintptr_t)child | 1, std::memory_order_acq_rel)){
+                    delete child;
+                }
+            }
+        }
+    };
 
-    std::vector<std::string>& StrName::_r_interned(){
-        static std::vector<std::string> r_interned;
-        return r_interned;
+    static InternTable& _intern_table(){
+        static InternTable* table = new InternTable();
+        return *table;
     }
 
     StrName StrName::get(std::string_view s){
-        auto it = _interned().find(s);
-        if(it != _interned().end()) return StrName(it->second);
-        uint16_t index = (uint16_t)(_r_interned().size() + 1);
-        std::string str(s);
-        _interned()[str] = index;
-        _r_interned().push_back(str);
-        return StrName(index);
+        return StrName(_intern_table().intern(s)->index);
     }
 
     Str StrName::escape() const {
         return Str(sv()).escape();
     }
 
-    bool StrName::is_valid(int index) {
-        // check _r_interned()[index-1] is valid
-        return index > 0 && index <= _r_interned().size();
+    bool StrName::is_valid(int64_t index) {
+        if(index <= 0 || index > UINT32_MAX) return false;
+        InternTable& table = _intern_table();
+        if(index > table.count.load(std::memory_order_acquire)) return false;
+        return table.at((uint32_t)index) != nullptr;
     }
 
     StrName::StrName(): index(0) {}
-    StrName::StrName(uint16_t index): index(index) {}
+    StrName::StrName(uint32_t index): index(index) {}
     StrName::StrName(const char* s): index(get(s).index) {}
     StrName::StrName(const Str& s){
         index = get(s.sv()).index;
     }
 
     std::string_view StrName::sv() const {
-        const std::string& str = _r_interned()[index-1];
-        return std::string_view(str);
+        return _intern_table().at(index)->str;
     }
 
     FastStrStream& FastStrStream::operator<<(const Str& s){
@@ -205,6 +205,44 @@ namespace pkpy{
         return false;
     }
 
+    bool VM::py_lt(PyObject* lhs, PyObject* rhs){
+        const PyTypeInfo* ti = _inst_type_info(lhs);
+        PyObject* res;
+        if(ti->m__lt__){
+            res = ti->m__lt__(this, lhs, rhs);
+        }else{
+            PyObject* self;
+            PyObject* f = get_unbound_method(lhs, __lt__, &self, false);
+            res = f != nullptr ? call_method(self, f, rhs) : vm->NotImplemented;
+        }
+        if(res != vm->NotImplemented) return py_bool(res);
+        // reflected operation
+        PyObject* self;
+        PyObject* f = get_unbound_method(rhs, __gt__, &self, false);
+        if(f != nullptr) res = call_method(self, f, lhs);
+        if(res == vm->NotImplemented) BinaryOptError("<");
+        return py_bool(res);
+    }
+
+    PyObject* VM::py_add(PyObject* lhs, PyObject* rhs){
+        const PyTypeInfo* ti = _inst_type_info(lhs);
+        PyObject* res;
+        if(ti->m__add__){
+            res = ti->m__add__(this, lhs, rhs);
+        }else{
+            PyObject* self;
+            PyObject* f = get_unbound_method(lhs, __add__, &self, false);
+            res = f != nullptr ? call_method(self, f, rhs) : vm->NotImplemented;
+        }
+        if(res != vm->NotImplemented) return res;
+        // reflected operation
+        PyObject* self;
+        PyObject* f = get_unbound_method(rhs, __radd__, &self, false);
+        if(f != nullptr) res = call_method(self, f, lhs);
+        if(res == vm->NotImplemented) BinaryOptError("+");
+        return res;
+    }
+
 
     int VM::normalized_index(int index, int size){
         if(index < 0) index += size;
@@ -224,7 +262,7 @@ namespace pkpy{
         if(path.empty()) vm->ValueError("empty module name");
         auto f_join = [](const std::vector<std::string_view>& cpnts){
             std::stringstream ss;
-            for(int i=0; i<cpnts.size(); i++){
+            for(int i=0; i<(int)cpnts.size(); i++){
                 if(i != 0) ss << ".";
                 ss << cpnts[i];
             }
@@ -244,7 +282,7 @@ namespace pkpy{
                 if(path[i] == '.') prefix++;
                 else break;
             }
-            if(prefix > cpnts.size()) ImportError("attempted relative import beyond top-level package");
+            if(prefix > (int)cpnts.size()) ImportError("attempted relative import beyond top-level package");
             path = path.substr(prefix);     // remove prefix
             for(int i=(int)curr_is_init; i<prefix; i++) cpnts.pop_back();
             if(!path.empty()) cpnts.push_back(path.sv());
@@ -271,6 +309,7 @@ namespace pkpy{
         Str filename = path.replace('.', kPlatformSep) + ".py";
         Str source;
         bool is_init = false;
+        bool is_file = false;
         auto it = _lazy_modules.find(name);
         if(it == _lazy_modules.end()){
             Bytes b = _import_handler(filename);
@@ -284,12 +323,21 @@ namespace pkpy{
                 else return nullptr;
             }
             source = Str(b.str());
+            is_file = true;
         }else{
             source = it->second;
             _lazy_modules.erase(it);
         }
         auto _ = _import_context.scope(path, is_init);
-        CodeObject_ code = compile(source, filename, EXEC_MODE);
+        CodeObject_ code = nullptr;
+        if(is_file && _bytecode_cache_loader != nullptr){
+            Bytes b = _bytecode_cache_loader(filename);
+            if(b) code = CodeObject::load(this, b, std::make_shared<SourceData>(source, filename, EXEC_MODE));
+        }
+        if(code == nullptr){
+            code = compile(source, filename, EXEC_MODE);
+            if(is_file && _bytecode_cache_writer != nullptr) _bytecode_cache_writer(filename, code->dump(this));
+        }
 
         Str name_cpnt = path_cpnts.back();
         path_cpnts.pop_back();
@@ -307,6 +355,22 @@ namespace pkpy{
         _lazy_modules.clear();
     }
 
+#if PK_DEBUG_OPCODE_PAIRS
+    // run at exit, so pairs from every VM in the process are included
+    OpcodePairCounter::~OpcodePairCounter(){
+        std::vector<std::tuple<i64, int, int>> pairs;
+        for(int i=0; i<N; i++){
+            for(int j=0; j<N; j++){
+                if(counts[i][j] > 0) pairs.emplace_back(counts[i][j], i, j);
+            }
+        }
+        std::sort(pairs.begin(), pairs.end(), std::greater<>());
+        for(auto [n, i, j]: pairs){
+            fprintf(stderr, "[opcode_pairs] %s %s %lld\n", OP_NAMES[i], OP_NAMES[j], (long long)n);
+        }
+    }
+#endif
+
 PyObject* VM::py_negate(PyObject* obj){
     const PyTypeInfo* ti = _inst_type_info(obj);
     if(ti->m__neg__) return ti->m__neg__(this, obj);
@@ -318,6 +382,7 @@ bool VM::py_bool(PyObject* obj){
     if(obj == None) return false;
     if(is_int(obj)) return _CAST(i64, obj) != 0;
     if(is_float(obj)) return _CAST(f64, obj) != 0.0;
+    if(is_non_tagged_type(obj, tp_long)) return !PK_OBJ_GET(BigInt, obj).is_zero();
     PyObject* self;
     PyObject* len_f = get_unbound_method(obj, __len__, &self, false);
     if(self != PY_NULL){
@@ -520,15 +585,25 @@ static std::string _opcode_argstr(VM* vm, Bytecode byte, const CodeObject* co){
                 argStr += fmt(" (", CAST(Str, vm->py_repr(co->consts[byte.arg])), ")");
             }
             break;
-        case OP_LOAD_NAME: case OP_LOAD_GLOBAL: case OP_LOAD_NONLOCAL: case OP_STORE_GLOBAL:
+        case OP_LOAD_NAME: case OP_LOAD_GLOBAL: case OP_STORE_GLOBAL:
         case OP_LOAD_ATTR: case OP_LOAD_METHOD: case OP_STORE_ATTR: case OP_DELETE_ATTR:
-        case OP_BEGIN_CLASS: case OP_RAISE: case OP_GOTO:
+        case OP_BEGIN_CLASS: case OP_RAISE: case OP_GOTO: case OP_LOAD_KWARG_NAME:
         case OP_DELETE_GLOBAL: case OP_INC_GLOBAL: case OP_DEC_GLOBAL: case OP_STORE_CLASS_ATTR:
             argStr += fmt(" (", StrName(byte.arg).sv(), ")");
             break;
         case OP_LOAD_FAST: case OP_STORE_FAST: case OP_DELETE_FAST: case OP_INC_FAST: case OP_DEC_FAST:
+        case OP_LOAD_DEREF: case OP_STORE_DEREF: case OP_DELETE_DEREF:
             argStr += fmt(" (", co->varnames[byte.arg].sv(), ")");
             break;
+        case OP_LOAD_FAST_LOAD_FAST:
+            argStr += fmt(" (", co->varnames[byte.arg >> 16].sv(), ", ", co->varnames[byte.arg & 0xFFFF].sv(), ")");
+            break;
+        case OP_LOAD_FAST_LOAD_INTEGER:
+            argStr += fmt(" (", co->varnames[byte.arg >> 16].sv(), ", ", (int16_t)(byte.arg & 0xFFFF), ")");
+            break;
+        case OP_LOAD_FAST_LOAD_ATTR:
+            argStr += fmt(" (", co->varnames[byte.arg >> 16].sv(), ", ", StrName(byte.arg & 0xFFFF).sv(), ")");
+            break;
         case OP_LOAD_FUNCTION:
             argStr += fmt(" (", co->func_decls[byte.arg]->code->name, ")");
             break;
@@ -544,8 +619,14 @@ Str VM::disassemble(CodeObject_ co){
 
     std::vector<int> jumpTargets;
     for(auto byte : co->codes){
-        if(byte.op == OP_JUMP_ABSOLUTE || byte.op == OP_POP_JUMP_IF_FALSE || byte.op == OP_SHORTCUT_IF_FALSE_OR_POP){
-            jumpTargets.push_back(byte.arg);
+        switch(byte.op){
+            case OP_JUMP_ABSOLUTE: case OP_POP_JUMP_IF_FALSE: case OP_POP_JUMP_IF_TRUE:
+            case OP_JUMP_IF_TRUE_OR_POP: case OP_JUMP_IF_FALSE_OR_POP: case OP_SHORTCUT_IF_FALSE_OR_POP:
+            case OP_COMPARE_LT_JUMP_IF_FALSE: case OP_COMPARE_LE_JUMP_IF_FALSE:
+            case OP_COMPARE_GT_JUMP_IF_FALSE: case OP_COMPARE_GE_JUMP_IF_FALSE:
+            case OP_COMPARE_EQ_JUMP_IF_FALSE: case OP_COMPARE_NE_JUMP_IF_FALSE:
+                jumpTargets.push_back(byte.arg);
+                break;
         }
         if(byte.op == OP_GOTO){
             // TODO: pre-compute jump targets for OP_GOTO
@@ -554,8 +635,9 @@ Str VM::disassemble(CodeObject_ co){
         }
     }
     std::stringstream ss;
+    ss << "# optimized: " << co->num_unoptimized_codes << " -> " << co->codes.size() << " instructions\n";
     int prev_line = -1;
-    for(int i=0; i<co->codes.size(); i++){
+    for(int i=0; i<(int)co->codes.size(); i++){
         const Bytecode& byte = co->codes[i];
         Str line = std::to_string(co->lines[i]);
         if(co->lines[i] == prev_line) line = "";
@@ -577,7 +659,7 @@ Str VM::disassemble(CodeObject_ co){
         ss << argStr;
         // ss << pad(argStr, 40);      // may overflow
         // ss << co->blocks[byte.block].type;
-        if(i != co->codes.size() - 1) ss << '\n';
+        if(i != (int)co->codes.size() - 1) ss << '\n';
     }
 
     for(auto& decl: co->func_decls){
@@ -665,6 +747,10 @@ void VM::init_builtin_types(){
     tp_dict = _new_type_object("dict");
     tp_property = _new_type_object("property");
     tp_star_wrapper = _new_type_object("_star_wrapper");
+    tp_set = _new_type_object("set");
+    tp_frozenset = _new_type_object("frozenset");
+    tp_long = _new_type_object("long");
+    tp_cell = _new_type_object("cell");
 
     this->None = heap._new<Dummy>(_new_type_object("NoneType"));
     this->NotImplemented = heap._new<Dummy>(_new_type_object("NotImplementedType"));
@@ -687,13 +773,16 @@ void VM::init_builtin_types(){
     builtins->attr().set("range", _t(tp_range));
     builtins->attr().set("bytes", _t(tp_bytes));
     builtins->attr().set("dict", _t(tp_dict));
+    builtins->attr().set("set", _t(tp_set));
+    builtins->attr().set("frozenset", _t(tp_frozenset));
+    builtins->attr().set("long", _t(tp_long));
     builtins->attr().set("property", _t(tp_property));
     builtins->attr().set("StopIteration", StopIteration);
     builtins->attr().set("NotImplemented", NotImplemented);
     builtins->attr().set("slice", _t(tp_slice));
 
     post_init();
-    for(int i=0; i<_all_types.size(); i++){
+    for(int i=0; i<(int)_all_types.size(); i++){
         _all_types[i].obj->attr()._try_perfect_rehash();
     }
     for(auto [k, v]: _modules.items()) v->attr()._try_perfect_rehash();
@@ -754,19 +843,17 @@ void VM::_prepare_py_call(PyObject** buffer, ArgsView args, ArgsView kwargs, con
     for(int index: decl->args) buffer[index] = args[i++];
     // set extra varnames to nullptr
     for(int j=i; j<co_nlocals; j++) buffer[j] = PY_NULL;
-    // prepare kwdefaults
-    for(auto& kv: decl->kwargs) buffer[kv.key] = kv.value;
     
     // handle *args
     if(decl->starred_arg != -1){
+        for(auto& kv: decl->kwargs) buffer[kv.key] = kv.value;
         ArgsView vargs(args.begin() + i, args.end());
         buffer[decl->starred_arg] = VAR(vargs.to_tuple());
         i += vargs.size();
     }else{
-        // kwdefaults override
+        // extra positional arguments override kwdefaults
         for(auto& kv: decl->kwargs){
-            if(i >= args.size()) break;
-            buffer[kv.key] = args[i++];
+            buffer[kv.key] = i < args.size() ? args[i++] : kv.value;
         }
         if(i < args.size()) TypeError(fmt("too many arguments", " (", decl->code->name, ')'));
     }
@@ -848,19 +935,31 @@ PyObject* VM::vectorcall(int ARGC, int KWARGC, bool op_call){
         const CodeObject* co = decl->code.get();
         int co_nlocals = co->varnames.size();
 
-        _prepare_py_call(buffer, args, kwargs, decl);
+        if(KWARGC == 0 && decl->is_simple && args.size() == decl->args.size()){
+            // the arguments are the first locals already, bind them in place
+            for(int j=args.size(); j<co_nlocals; j++) PUSH(PY_NULL);
+        }else{
+            _prepare_py_call(buffer, args, kwargs, decl);
+            // copy buffer back to stack
+            s_data.reset(args.begin());
+            for(int j=0; j<co_nlocals; j++) PUSH(buffer[j]);
+        }
+        PyObject** locals = args.begin();
+        // captured locals live in cells, the closure provides the cells of enclosing functions
+        for(int index: co->cellvars) locals[index] = VAR(Cell(locals[index]));
+        for(int i=0; i<co->freevars.size(); i++){
+            locals[co->freevars[i].index] = PK_OBJ_GET(Tuple, fn._closure)[i];
+        }
         
         if(co->is_generator){
-            s_data.reset(p0);
-            return _py_generator(
+            PyObject* ret = _py_generator(
                 Frame(&s_data, nullptr, co, fn._module, callable),
-                ArgsView(buffer, buffer + co_nlocals)
+                ArgsView(locals, locals + co_nlocals)
             );
+            s_data.reset(p0);
+            return ret;
         }
 
-        // copy buffer back to stack
-        s_data.reset(args.begin());
-        for(int j=0; j<co_nlocals; j++) PUSH(buffer[j]);
         callstack.emplace(&s_data, p0, co, fn._module, callable, FastLocals(co, args.begin()));
         if(op_call) return PY_OP_CALL;
         return _run_top_frame();
@@ -1032,6 +1131,100 @@ void VM::setattr(PyObject* obj, StrName name, PyObject* value){
     // handle instance __dict__
     if(is_tagged(obj) || !obj->is_attr_valid()) TypeError("cannot set attribute");
     obj->attr().set(name, value);
+    heap.write_barrier(obj);
+    if(is_non_tagged_type(obj, tp_type)) _type_modified(PK_OBJ_GET(Type, obj));
+}
+
+// invalidate inline caches of `type` and all its subclasses
+void VM::_type_modified(Type type){
+    // a subclass is always created after its base
+    for(int i=type.index; i<(int)_all_types.size(); i++){
+        if(issubclass(i, type)) _all_types[i].version = ++_type_version;
+    }
+}
+
+void VM::_fill_attr_cache(AttrCache& cache, Type type, StrName name){
+    PyObject* cls_var = find_name_in_mro(_t(type), name);
+    cache.cls_var = cls_var;
+    cache.type = type;
+    cache.version = _all_types[type].version;
+    if(cls_var == nullptr){
+        cache.kind = ATTR_CACHE_INSTANCE;
+    }else if(is_non_tagged_type(cls_var, tp_property)){
+        cache.kind = ATTR_CACHE_PROPERTY;
+    }else if(is_non_tagged_type(cls_var, tp_function) || is_non_tagged_type(cls_var, tp_native_func)){
+        cache.kind = ATTR_CACHE_METHOD;
+    }else{
+        cache.kind = ATTR_CACHE_CLASS_VAR;
+    }
+}
+
+// same as `getattr` but skips the mro lookup if `cache` hits
+PyObject* VM::_getattr_cached(AttrCache& cache, PyObject* obj, StrName name){
+    if(is_non_tagged_type(obj, tp_super)) return getattr(obj, name);
+    Type type = _tp(obj);
+    if(cache.type != type || cache.version != _all_types[type].version){
+        _fill_attr_cache(cache, type, name);
+    }
+    if(cache.kind == ATTR_CACHE_PROPERTY){
+        return call(PK_OBJ_GET(Property, cache.cls_var).getter, obj);
+    }
+    if(!is_tagged(obj) && obj->is_attr_valid()){
+        PyObject* val = obj->attr().try_get(name);
+        if(val != nullptr) return val;
+    }
+    switch(cache.kind){
+        case ATTR_CACHE_METHOD: return VAR(BoundMethod(obj, cache.cls_var));
+        case ATTR_CACHE_CLASS_VAR: return cache.cls_var;
+        default: return getattr(obj, name);
+    }
+}
+
+// same as `get_unbound_method(..., true, true)` but skips the mro lookup if `cache` hits
+PyObject* VM::_get_unbound_method_cached(AttrCache& cache, PyObject* obj, StrName name, PyObject** self){
+    if(is_non_tagged_type(obj, tp_super)) return get_unbound_method(obj, name, self, true, true);
+    *self = PY_NULL;
+    Type type = _tp(obj);
+    if(cache.type != type || cache.version != _all_types[type].version){
+        _fill_attr_cache(cache, type, name);
+    }
+    if(cache.kind == ATTR_CACHE_PROPERTY){
+        return call(PK_OBJ_GET(Property, cache.cls_var).getter, obj);
+    }
+    if(!is_tagged(obj) && obj->is_attr_valid()){
+        PyObject* val = obj->attr().try_get(name);
+        if(val != nullptr) return val;
+    }
+    switch(cache.kind){
+        case ATTR_CACHE_METHOD: *self = obj; return cache.cls_var;
+        case ATTR_CACHE_CLASS_VAR: return cache.cls_var;
+        default: return get_unbound_method(obj, name, self, true, true);
+    }
+}
+
+// same as `setattr` but skips the mro lookup if `cache` hits
+void VM::_setattr_cached(AttrCache& cache, PyObject* obj, StrName name, PyObject* value){
+    // type objects need to invalidate caches
+    if(is_non_tagged_type(obj, tp_super) || is_non_tagged_type(obj, tp_type)){
+        setattr(obj, name, value);
+        return;
+    }
+    Type type = _tp(obj);
+    if(cache.type != type || cache.version != _all_types[type].version){
+        _fill_attr_cache(cache, type, name);
+    }
+    if(cache.kind == ATTR_CACHE_PROPERTY){
+        const Property& prop = PK_OBJ_GET(Property, cache.cls_var);
+        if(prop.setter != vm->None){
+            call(prop.setter, obj, value);
+        }else{
+            TypeError(fmt("readonly attribute: ", name.escape()));
+        }
+        return;
+    }
+    if(is_tagged(obj) || !obj->is_attr_valid()) TypeError("cannot set attribute");
+    obj->attr().set(name, value);
+    heap.write_barrier(obj);
 }
 
 PyObject* VM::bind(PyObject* obj, const char* sig, NativeFuncC fn, UserData userdata){
@@ -1056,7 +1249,11 @@ PyObject* VM::bind(PyObject* obj, const char* sig, const char* docstring, Native
     }
     PyObject* f_obj = VAR(NativeFunc(fn, decl));
     PK_OBJ_GET(NativeFunc, f_obj).set_userdata(userdata);
-    if(obj != nullptr) obj->attr().set(decl->code->name, f_obj);
+    if(obj != nullptr){
+        obj->attr().set(decl->code->name, f_obj);
+        heap.write_barrier(obj);
+        if(is_non_tagged_type(obj, tp_type)) _type_modified(PK_OBJ_GET(Type, obj));
+    }
     return f_obj;
 }
 
@@ -1069,6 +1266,8 @@ PyObject* VM::bind_property(PyObject* obj, Str name, NativeFuncC fget, NativeFun
     if(pos > 0) name = name.substr(0, pos).strip();
     PyObject* prop = VAR(Property(_0, _1, signature));
     obj->attr().set(name, prop);
+    heap.write_barrier(obj);
+    if(is_non_tagged_type(obj, tp_type)) _type_modified(PK_OBJ_GET(Type, obj));
     return prop;
 }
 
@@ -1095,6 +1294,48 @@ void VM::_raise(bool re_raise){
 
 void ManagedHeap::mark() {
     for(PyObject* obj: _no_gc) PK_OBJ_MARK(obj);
+    _mark_roots();
+    _propagate();
+}
+
+void ManagedHeap::mark_young() {
+    // old objects are marked already, only scan the ones which may reference young objects
+    auto mark_children = [this](PyObject* obj){
+        obj->gc.marked = true;
+        _scan(obj);
+    };
+    for(PyObject* obj: _no_gc) mark_children(obj);
+    for(PyObject* obj: _remembered){
+        mark_children(obj);
+        obj->gc.remembered = false;
+    }
+    _remembered.clear();
+    _mark_roots();
+    _propagate();
+}
+
+void ManagedHeap::_set_hooks(Type type, const PyObjectHooks& hooks){
+    if(type.index >= (int)_type_hooks.size()){
+        _type_hooks.resize(type.index + 1, PyObjectHooks{nullptr, nullptr});
+    }
+    PyObjectHooks& slot = _type_hooks[type.index];
+    // a type must always be instantiated by the same `Py_<T>`, e.g. `object.__new__(list)` is not allowed
+    if(slot.destroy != nullptr){
+        vm->TypeError(fmt("cannot create '", obj_type_name(vm, type), "' instances"));
+    }
+    slot = hooks;
+}
+
+void ManagedHeap::_propagate() {
+    auto& gray = _gc_gray_objects;
+    while(!gray.empty()){
+        PyObject* obj = gray.back();
+        gray.pop_back();
+        _scan(obj);
+    }
+}
+
+void ManagedHeap::_mark_roots() {
     for(auto& frame : vm->callstack.data()) frame._gc_mark();
     for(PyObject* obj: vm->s_data) PK_OBJ_MARK(obj);
     if(_gc_marker_ex) _gc_marker_ex(vm);
@@ -1127,31 +1368,55 @@ void VM::bind__len__(Type type, i64 (*f)(VM*, PyObject*)){
     PK_OBJ_GET(NativeFunc, nf).set_userdata(f);
 }
 
-void Dict::_probe_0(PyObject *key, bool &ok, int &i) const{
+// `int` and `str` keys skip the `__hash__`/`__eq__` dispatch,
+// a `str` key uses its cached hash
+i64 Dict::_hash(PyObject* key) const{
+    if(is_small_int(key)) return (i64)(PK_BITS(key) >> 2);
+    if(is_non_tagged_type(key, vm->tp_str)) return (i64)PK_OBJ_GET(Str, key).hash();
+    return vm->py_hash(key);
+}
+
+static inline bool _dict_equals(VM* vm, PyObject* a, PyObject* key, bool key_is_str){
+    if(a == key) return true;
+    if(key_is_str && is_non_tagged_type(a, vm->tp_str)){
+        return PK_OBJ_GET(Str, a) == PK_OBJ_GET(Str, key);
+    }
+    return vm->py_equals(a, key);
+}
+
+// `i` is set to the slot of `key` in `_indices`
+void Dict::_probe_0(PyObject *key, i64 hash, bool &ok, int &i) const{
     ok = false;
-    i64 hash = vm->py_hash(key);
+    bool key_is_str = is_non_tagged_type(key, vm->tp_str);
     i = hash & _mask;
-    // std::cout << CAST(Str, vm->py_repr(key)) << " " << hash << " " << i << std::endl;
-    for(int j=0; j<_capacity; j++) {
-        if(_items[i].first != nullptr){
-            if(vm->py_equals(_items[i].first, key)) { ok = true; break; }
-        }else{
-            if(_items[i].second == nullptr) break;
+    while(true){
+        int ix = _index_at(i);
+        if(ix == kEmptySlot) break;
+        if(ix >= 0 && _items[ix].hash == hash){
+            if(_dict_equals(vm, _items[ix].first, key, key_is_str)) { ok = true; break; }
         }
         // https://github.com/python/cpython/blob/3.8/Objects/dictobject.c#L166
         i = ((5*i) + 1) & _mask;
-        // std::cout << CAST(Str, vm->py_repr(key)) << " next: " << i << std::endl;
     }
 }
 
-void Dict::_probe_1(PyObject *key, bool &ok, int &i) const{
+// like `_probe_0`, but if `key` is not found, `i` is set to a free slot for it
+void Dict::_probe_1(PyObject *key, i64 hash, bool &ok, int &i) const{
     ok = false;
-    i = vm->py_hash(key) & _mask;
-    while(_items[i].first != nullptr) {
-        if(vm->py_equals(_items[i].first, key)) { ok = true; break; }
-        // https://github.com/python/cpython/blob/3.8/Objects/dictobject.c#L166
+    bool key_is_str = is_non_tagged_type(key, vm->tp_str);
+    int free_slot = -1;
+    i = hash & _mask;
+    while(true){
+        int ix = _index_at(i);
+        if(ix == kEmptySlot) break;
+        if(ix == kDeletedSlot){
+            if(free_slot == -1) free_slot = i;
+        }else if(_items[ix].hash == hash){
+            if(_dict_equals(vm, _items[ix].first, key, key_is_str)) { ok = true; return; }
+        }
         i = ((5*i) + 1) & _mask;
     }
+    if(free_slot != -1) i = free_slot;
 }
 
 void CodeObjectSerializer::write_object(VM *vm, PyObject *obj){
@@ -1161,11 +1426,61 @@ void CodeObjectSerializer::write_object(VM *vm, PyObject *obj){
     else if(is_type(obj, vm->tp_bool)) write_bool(_CAST(bool, obj));
     else if(obj == vm->None) write_none();
     else if(obj == vm->Ellipsis) write_ellipsis();
-    else{
+    else if(is_type(obj, vm->tp_tuple)){
+        write_begin_mark();
+        for(PyObject* item: _CAST(Tuple&, obj)) write_object(vm, item);
+        write_end_mark();
+    }else{
+        throw std::runtime_error(fmt(OBJ_NAME(vm->_t(obj)).escape(), " is not serializable"));
+    }
+}
+
+void CodeObjectWriter::write_object(PyObject* obj){
+    if(is_int(obj)){
+        write<char>('i');
+        write<i64>(_CAST(i64, obj));
+    }else if(is_float(obj)){
+        write<char>('f');
+        write<f64>(_CAST(f64, obj));
+    }else if(is_type(obj, vm->tp_str)){
+        write<char>('s');
+        write_str(_CAST(Str&, obj).sv());
+    }else if(is_type(obj, vm->tp_bool)){
+        write<char>('b');
+        write<bool>(_CAST(bool, obj));
+    }else if(obj == vm->None){
+        write<char>('N');
+    }else if(obj == vm->Ellipsis){
+        write<char>('E');
+    }else if(is_type(obj, vm->tp_tuple)){
+        const Tuple& t = _CAST(Tuple&, obj);
+        write<char>('t');
+        write<int>(t.size());
+        for(PyObject* item: t) write_object(item);
+    }else{
         throw std::runtime_error(fmt(OBJ_NAME(vm->_t(obj)).escape(), " is not serializable"));
     }
 }
 
+PyObject* CodeObjectReader::read_object(){
+    switch(read<char>()){
+        case 'i': return VAR(read<i64>());
+        case 'f': return VAR(read<f64>());
+        case 's': return VAR(read_str());
+        case 'b': return VAR(read<bool>());
+        case 'N': return vm->None;
+        case 'E': return vm->Ellipsis;
+        case 't': {
+            int n = read<int>();
+            if(n < 0) throw std::runtime_error("invalid tuple in bytecode");
+            Tuple t(n);
+            for(int i=0; i<n; i++) t[i] = read_object();
+            return VAR(std::move(t));
+        }
+        default: throw std::runtime_error("invalid object in bytecode");
+    }
+}
+
 void NativeFunc::check_size(VM* vm, ArgsView args) const{
     if(args.size() != argc && argc != -1) {
         vm->TypeError(fmt("expected ", argc, " arguments, got ", args.size()));
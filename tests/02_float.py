@@ -59,3 +59,28 @@ assert math.isnan(0/0)
 assert 2**-600 == 0.0
 assert 2.0 ** 600 == inf
 assert (-2.0) ** 601 == -inf
+
+# specialized instructions must fall back for other types
+def add(a, b): return a + b
+def sub(a, b): return a - b
+def mul(a, b): return a * b
+def div(a, b): return a / b
+def lt(a, b): return a < b
+def ge(a, b): return a >= b
+
+for _ in range(3):
+    assert add(1.5, 2) == 3.5
+    assert add(1, 2) == 3 and type(add(1, 2)) is int
+    assert add('a', 'b') == 'ab'
+    assert add([1], [2]) == [1, 2]
+    assert sub(2, 0.5) == 1.5
+    assert sub(5, 3) == 2
+    assert mul(2.0, 3) == 6.0
+    assert mul('a', 3) == 'aaa'
+    assert div(1, 2) == 0.5
+    assert div(1.0, 4) == 0.25
+    assert lt(1, 2) and not lt(2, 1)
+    assert lt(1.5, 2) and not lt(2, 1.5)
+    assert lt('a', 'b')
+    assert ge(2, 2) and ge(2.5, 2) and not ge(1, 2.5)
+    assert ge((1, 2), (1, 1))
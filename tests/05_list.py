@@ -76,6 +76,43 @@ b = [(1, 2), (3, 3), (5, 1)]
 b.sort(key=lambda x:x[1])
 assert b == [(5, 1), (1, 2), (3,3)]
 
+# sort is stable, also when reversed
+b = [(1, 'a'), (0, 'b'), (1, 'c'), (0, 'd')]
+assert sorted(b, key=lambda x:x[0]) == [(0, 'b'), (0, 'd'), (1, 'a'), (1, 'c')]
+assert sorted(b, key=lambda x:x[0], reverse=True) == [(1, 'a'), (1, 'c'), (0, 'b'), (0, 'd')]
+
+# key is evaluated once per element
+calls = [0]
+def f(x):
+    calls[0] += 1
+    return -x
+a = list(range(100))
+a.sort(key=f)
+assert calls[0] == 100
+assert a == list(range(99, -1, -1))
+
+# natural runs, mixed types and fast paths
+a = list(range(1000)) + list(range(500, 0, -1))
+a.sort()
+assert a == sorted(list(range(1000)) + list(range(1, 501)))
+assert sorted([3.5, -1.25, 2.0, 0.0]) == [-1.25, 0.0, 2.0, 3.5]
+assert sorted([1, 2.5, -3, 0.5]) == [-3, 0.5, 1, 2.5]
+assert sorted(['b', 'ab', 'a', '']) == ['', 'a', 'ab', 'b']
+assert sorted([[2, 1], [1, 2], [1]]) == [[1], [1, 2], [2, 1]]
+
+import random
+a = [random.randint(-1000, 1000) for i in range(5000)]
+b = sorted(a)
+for i in range(1, len(b)):
+    assert b[i-1] <= b[i]
+assert sorted(b, reverse=True) == b[::-1]
+
+try:
+    [1, 'a', 2].sort()
+    exit(1)
+except TypeError:
+    pass
+
 # unpacking builder
 a = [1, 2, 3]
 b = [*a, 4, 5]
@@ -95,3 +132,39 @@ assert b[0
 assert b[0] == 1
 assert b[
     0] == 1
+
+# specialized subscript must fall back for other types
+def getitem(a, i): return a[i]
+def setitem(a, i, v): a[i] = v
+
+for _ in range(3):
+    a = [1, 2, 3]
+    assert getitem(a, 0) == 1
+    assert getitem(a, -1) == 3
+    assert getitem((4, 5), 1) == 5
+    assert getitem({'k': 1}, 'k') == 1
+    assert getitem(a, slice(1, None, None)) == [2, 3]
+    setitem(a, -1, 4)
+    assert a == [1, 2, 4]
+    d = {}
+    setitem(d, 'x', 1)
+    assert d == {'x': 1}
+    try:
+        getitem(a, 3)
+        exit(1)
+    except IndexError:
+        pass
+
+# the key function must not modify the list
+a = [3, 1, 2]
+try:
+    a.sort(key=lambda x: a.clear() or x)
+    exit(1)
+except ValueError:
+    pass
+a = [3, 1, 2]
+try:
+    a.sort(key=lambda x: a.append(x) or x)
+    exit(1)
+except ValueError:
+    pass
@@ -142,3 +142,29 @@ try:
     exit(1)
 except TypeError:
     pass
+
+# str keys built in different ways
+k1 = 'a' * 40
+k2 = ''.join(['a'] * 40)
+assert hash(k1) == hash(k2)
+d = {k1: 1, 'b': 2}
+assert d[k2] == 1
+assert ('a' * 39) not in d
+assert hash(b'abc') == hash(bytes([97, 98, 99]))
+
+# insertion order survives deletions, reinsertion and shrinking
+d = {}
+for i in range(1000):
+    d[i] = i
+for i in range(0, 1000, 2):
+    del d[i]
+assert list(d.keys()) == list(range(1, 1000, 2))
+d[0] = 0
+assert list(d.keys())[-1] == 0
+for i in range(1, 1000, 2):
+    del d[i]
+assert d == {0: 0}
+d.clear()
+assert len(d) == 0
+d['x'] = 1
+assert list(d.items()) == [('x', 1)]
@@ -85,4 +85,124 @@ assert b == {1, 2, 3, 4, 5}
 
 a = set()
 b = {*a, 1, 2, 3, *a, *a}
-assert b == {1, 2, 3}
\ No newline at end of file
+assert b == {1, 2, 3}
+# native set
+assert repr(set()) == 'set()'
+assert repr({1, 2}) == '{1, 2}'
+assert set('aab') == {'a', 'b'}
+assert set(range(3)) == {0, 1, 2}
+assert {1, 2} <= {1, 2, 3} and {1, 2} < {1, 2, 3} and not {1, 2} < {1, 2}
+assert {1, 2, 3} >= {1, 2} and {1, 2, 3} > {1, 2}
+assert {1, 2} != {1, 3}
+
+a = {1, 2, 3}
+assert a.pop() == 3
+assert len(a) == 2
+try:
+    set().pop()
+    exit(1)
+except KeyError:
+    pass
+try:
+    a.remove(10)
+    exit(1)
+except KeyError:
+    pass
+try:
+    hash({1})
+    exit(1)
+except TypeError:
+    pass
+
+a = {1, 2, 3}
+a.difference_update([2])
+assert a == {1, 3}
+a.intersection_update([3, 4])
+assert a == {3}
+assert {1, 2}.union([3]) == {1, 2, 3}
+
+a = set()
+for i in range(1000):
+    a.add(i)
+for i in range(1000):
+    assert a.pop() == 999 - i
+assert len(a) == 0
+
+# frozenset
+f = frozenset([1, 2, 3])
+assert type(f) is frozenset
+assert f == {1, 2, 3}
+assert repr(frozenset()) == 'frozenset()'
+assert repr(frozenset([1])) == 'frozenset({1})'
+assert hash(f) == hash(frozenset([3, 2, 1]))
+assert type(f | {4}) is frozenset
+assert type({4} | f) is set
+d = {f: 1}
+assert d[frozenset({1, 2, 3})] == 1
+try:
+    f.add(4)
+    exit(1)
+except AttributeError:
+    pass
+
+# the other operand can be a generator, and `__hash__` can allocate
+class Key:
+    def __init__(self, v):
+        self.v = v
+    def __hash__(self):
+        garbage = [[i] for i in range(50)]
+        return hash(self.v)
+    def __eq__(self, other):
+        garbage = [[i] for i in range(50)]
+        return isinstance(other, Key) and self.v == other.v
+
+def keys(n):
+    for i in range(n):
+        yield Key(i)
+
+s = set([Key(i) for i in range(0, 400, 2)])
+for _ in range(5):
+    assert len(s.union(keys(400))) == 400
+    assert len(s.intersection(keys(400))) == 200
+    assert len(s.difference(keys(400))) == 0
+    assert len(s.symmetric_difference(keys(400))) == 200
+    assert s.issubset(keys(400))
+    assert not s.issuperset(keys(400))
+    assert not s.isdisjoint(keys(400))
+t = set(s)
+t.difference_update(keys(100))
+assert len(t) == 150
+t.intersection_update(keys(200))
+assert len(t) == 50
+
+# subclasses
+class S(set):
+    def total(self):
+        return sum(list(self))
+
+s = S([1, 2])
+assert type(s) is S and isinstance(s, set)
+assert repr(s) == 'S({1, 2})' and repr(S()) == 'S()'
+s.add(3)
+s.tag = 'x'
+assert s.tag == 'x' and s.total() == 6
+assert s == {1, 2, 3} and {0} | s == {0, 1, 2, 3}
+assert type(s | {4}) is set and type(s.copy()) is set
+
+class F(frozenset):
+    pass
+
+f = F([1, 2])
+assert repr(f) == 'F({1, 2})'
+assert hash(f) == hash(frozenset([1, 2]))
+assert {f: 1}[frozenset([1, 2])] == 1
+
+class Bad(set):
+    def __new__(cls):
+        return object.__new__(cls)
+
+try:
+    Bad()
+    exit(1)
+except TypeError:
+    pass
@@ -35,4 +35,69 @@ assert s == [4, 6, 7, 2, 3]
 
 assert 1 < 2L < 3 < 6.6
 assert 1L < 2 < 9.6 >= 7 > 2L
-assert 1L < 2 < 3 < 6.6
\ No newline at end of file
+assert 1L < 2 < 3 < 6.6
+
+# int overflow promotes to long
+a = 2 ** 62
+assert type(a) is int
+assert type(a * 4) is long
+assert a * 4 == 2 ** 64 == 18446744073709551616L
+assert 9223372036854775807 + 1 == 9223372036854775808L
+assert -9223372036854775807 - 2 == -9223372036854775809L
+assert 1 << 100 == 2L ** 100
+assert -(-9223372036854775807 - 1) == 9223372036854775808L
+assert abs(-9223372036854775807 - 1) == 9223372036854775808L
+assert 3 ** 50 == 717897987691852588770249L
+
+# str and repr
+assert str(12345678901234567890L) == '12345678901234567890'
+assert repr(-12345678901234567890L) == '-12345678901234567890L'
+assert long(repr(-7L)) == -7
+assert str(0L) == '0'
+
+# floor division and modulo, like python
+assert 7L // 2 == 3 and 7L % 2 == 1
+assert -7L // 2 == -4 and -7L % 2 == 1
+assert 7L // -2 == -4 and 7L % -2 == -1
+assert divmod(-(10L ** 30), 7) == (-142857142857142857142857142858L, 6)
+
+# multiplication and division of large operands
+x = 3L ** 2000
+y = 7L ** 1500
+assert (x * y) // y == x
+assert (x * y + 12345) % y == 12345
+assert x * y == y * x
+
+# bitwise operations
+assert (2L ** 70 - 1) & 0xFF == 255
+assert (2L ** 70) | 1 == 2L ** 70 + 1
+assert (2L ** 70) ^ (2L ** 70) == 0
+assert -1L & 0xFFFF == 0xFFFF
+assert ~(2L ** 70) == -(2L ** 70) - 1
+assert -(2L ** 70) >> 69 == -2
+assert (2L ** 70).bit_length() == 71
+
+# pow with modulus
+assert pow(3, 1000, 1000000007) == 56888193
+assert pow(2L, 10000, 10L ** 20 + 39) == pow(2, 10000, 100000000000000000039)
+assert pow(-3, 3, 7) == 1
+assert pow(3, 3, -7) == -1
+assert pow(2, 5) == 32
+
+# mixed with int and float
+assert long(2.5) == 2
+assert float(2L ** 64) == 18446744073709551616.0
+assert 2L ** 64 / 2 ** 63 == 2.0
+assert 0.5 + 1L == 1.5
+assert 2L ** 64 > 1.0
+
+# hash and equality agree with int
+d = {5L: 'a', 2L ** 80: 'b'}
+assert d[5] == 'a'
+assert d[2 ** 80] == 'b'
+assert int(5L) == 5 and type(int(5L)) is int
+assert bool(0L) is False and bool(3L) is True
+
+# decimal literals out of the range of int are long
+assert 100000000000000000000 == 10L ** 20
+assert type(-9223372036854775808) is long
@@ -91,4 +91,33 @@ S, kwargs = g(1, 2, 3, 4, 5, c=4, e=5, f=6)
 # S = 1 + 2 + 4 + 2 + 12 = 21
 
 assert S == 21
-assert kwargs == {'e': 5, 'f': 6}
\ No newline at end of file
+assert kwargs == {'e': 5, 'f': 6}
+# positional-only calls bind arguments in place
+def h(a, b):
+    c = a * 10
+    return c + b
+
+assert h(1, 2) == 12
+try:
+    h(1)
+    exit(1)
+except TypeError:
+    pass
+try:
+    h(1, 2, 3)
+    exit(1)
+except TypeError:
+    pass
+
+def k(a, b=2, c=3):
+    return a + b * 10 + c * 100
+
+assert k(1) == 321
+assert k(1, 5) == 351
+assert k(1, 5, 6) == 651
+assert k(1, c=7) == 721
+try:
+    k(1, 2, 3, 4)
+    exit(1)
+except TypeError:
+    pass
@@ -26,18 +26,18 @@ assert len(a) == 1
 assert a == [1]
 
 a = [1, 2, 3, 4]
-assert reversed(a) == [4, 3, 2, 1]
+assert list(reversed(a)) == [4, 3, 2, 1]
 assert a == [1, 2, 3, 4]
 a = (1, 2, 3, 4)
-assert reversed(a) == [4, 3, 2, 1]
+assert list(reversed(a)) == [4, 3, 2, 1]
 assert a == (1, 2, 3, 4)
 a = '1234'
-assert reversed(a) == ['4', '3', '2', '1']
+assert list(reversed(a)) == ['4', '3', '2', '1']
 assert a == '1234'
 
-assert reversed([]) == []
-assert reversed('') == []
-assert reversed('测试') == ['试', '测']
+assert list(reversed([])) == []
+assert list(reversed('')) == []
+assert list(reversed('测试')) == ['试', '测']
 
 a = [
     [(i,j) for j in range(10) if j % 2 == 0]
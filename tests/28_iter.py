@@ -36,3 +36,33 @@ assert next(i) == 4
 assert next(i) == 5
 assert next(i) == StopIteration
 assert next(i) == StopIteration
+
+# specialized FOR_ITER must fall back for other iterables
+def collect(it):
+    return [x for x in it]
+
+def collect_nested(n):
+    res = []
+    for i in range(n):
+        res.append(collect(range(i)) if i % 2 else collect([i, i]))
+    return res
+
+for _ in range(2):
+    assert collect(range(3)) == [0, 1, 2]
+    assert collect(range(3, 0, -1)) == [3, 2, 1]
+    assert collect([1, 2]) == [1, 2]
+    assert collect((3, 4)) == [3, 4]
+    assert collect('ab') == ['a', 'b']
+    assert collect({'k': 1}) == ['k']
+    assert collect_nested(4) == [[0, 0], [0], [2, 2], [0, 1, 2]]
+
+def recurse(n):
+    if n == 0:
+        return []
+    res = []
+    for x in (range(n) if n % 2 else [n]):
+        res.append(x)
+        res.extend(recurse(n - 1))
+    return res
+
+assert recurse(3) == [0, 2, 0, 1, 2, 0, 2, 2, 0]
@@ -117,3 +117,63 @@ class A(c.void_p):
     
 a = A(0)
 assert repr(a).startswith('<void* at')
+
+# inline caches of attribute access
+class Base:
+    def f(self):
+        return 1
+
+class Derived(Base):
+    pass
+
+def call_f(objs):
+    return [o.f() for o in objs]
+
+def get_f(o):
+    return o.f
+
+d = Derived()
+assert call_f([d, d]) == [1, 1]
+Base.f = lambda self: 2
+assert call_f([d, d]) == [2, 2]
+Derived.f = lambda self: 3
+assert call_f([d, Base()]) == [3, 2]
+del Derived.f
+assert call_f([d, Base()]) == [2, 2]
+
+# instance attribute shadows a method
+d.f = lambda: 4
+assert call_f([d]) == [4]
+assert get_f(d)() == 4
+del d.f
+assert get_f(d)() == 2
+
+# property added after the cache is filled
+class P:
+    pass
+
+def set_x(o, v):
+    o.x = v
+
+def get_x(o):
+    return o.x
+
+p = P()
+set_x(p, 1)
+assert get_x(p) == 1
+P.x = property(lambda self: 10)
+assert get_x(p) == 10
+try:
+    set_x(p, 2)
+    exit(1)
+except TypeError:
+    pass
+
+# instances of a type always have the same layout
+x = [1, 2, 3]
+try:
+    object.__new__(list)
+    exit(1)
+except TypeError:
+    pass
+assert x == [1, 2, 3]
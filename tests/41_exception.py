@@ -81,4 +81,64 @@ def f(a: list):
     a[0] = 1
 a = [0]
 f(a)
-assert a == [1]
\ No newline at end of file
+assert a == [1]
+# unwinding several frames at once
+def g(n):
+    if n == 0:
+        raise IndexError('bottom')
+    return g(n - 1) + 1
+
+for _ in range(3):
+    try:
+        g(50)
+        exit(1)
+    except IndexError:
+        pass
+
+def h():
+    try:
+        g(10)
+    except KeyError:
+        exit(1)
+
+try:
+    h()
+    exit(1)
+except IndexError:
+    pass
+
+# raised by native code in a nested frame
+def k(d):
+    return d['missing']
+
+def m(d):
+    try:
+        return k(d)
+    except ValueError:
+        exit(1)
+
+try:
+    m({})
+    exit(1)
+except KeyError:
+    pass
+
+# an exception crossing a native call
+def key(x):
+    if x == 3:
+        raise ValueError('3')
+    return x
+
+try:
+    sorted([1, 2, 3], key=key)
+    exit(1)
+except ValueError:
+    pass
+
+# exceptions handled inside exec() do not touch the stack of the caller
+def f():
+    a = 1
+    for i in range(3):
+        exec("try:\n    raise KeyError\nexcept KeyError:\n    a = 5\n")
+    return a
+assert f() == 5
@@ -1,5 +1,3 @@
-# only one level nested closure is implemented
-
 def f0(a, b):
     def f1():
         return a + b
@@ -24,4 +22,176 @@ def f3(x, y):
     return lambda z: x + y + z
 
 a = f3(1, 2)
-assert a(3) == 6
\ No newline at end of file
+assert a(3) == 6
+
+# variables are shared through cells, not copied
+def outer():
+    x = 1
+    def g():
+        return x
+    x = 2
+    return g()
+assert outer() == 2
+
+def counter():
+    n = 0
+    def inc():
+        nonlocal n
+        n += 1
+        return n
+    return inc
+c = counter()
+assert c() == 1 and c() == 2 and c() == 3
+c2 = counter()
+assert c2() == 1 and c() == 4
+
+def a():
+    x = 10
+    def b():
+        def c():
+            return x + 1
+        return c()
+    return b()
+assert a() == 11
+
+def make():
+    fs = []
+    for i in range(3):
+        fs.append(lambda: i)
+    return [f() for f in fs]
+assert make() == [2, 2, 2]
+
+def fact_outer(k):
+    def fact(n):
+        if n <= 1: return 1
+        return n * fact(n - 1)
+    return fact(k)
+assert fact_outer(5) == 120
+
+class A:
+    def __init__(self):
+        self.v = 3
+    def get(self):
+        return self.v
+
+class B(A):
+    def get(self):
+        f = lambda: self.v
+        return super().get() + f()
+assert B().get() == 6
+
+def param_capture(p):
+    def g():
+        return p * 2
+    return g
+assert param_capture(4)() == 8
+
+def deep():
+    x = 1
+    def l1():
+        nonlocal x
+        def l2():
+            nonlocal x
+            x += 10
+        l2()
+        x += 100
+    l1()
+    return x
+assert deep() == 111
+
+def gen_closure():
+    total = 0
+    def add(v):
+        nonlocal total
+        total += v
+    for i in range(5):
+        add(i)
+    return total
+assert gen_closure() == 10
+
+def gen():
+    x = 5
+    def get():
+        return x
+    yield get()
+    x = 6
+    yield get()
+assert list(gen()) == [5, 6]
+
+def with_eval():
+    x = 7
+    def g():
+        return x
+    return eval('x') + g()
+assert with_eval() == 14
+
+
+# assigning a captured variable needs `nonlocal`
+try:
+    exec('def f():\n  x = 1\n  def g():\n    print(x)\n    x = 2\n  return g')
+    exit(1)
+except SyntaxError:
+    pass
+try:
+    exec('def f():\n  nonlocal x\n')
+    exit(1)
+except SyntaxError:
+    pass
+def h():
+    x = 1
+    def g():
+        nonlocal x
+        ++x
+        --x
+        ++x
+    g()
+    ++x
+    return x
+assert h() == 3
+def k():
+    x = 1
+    def g():
+        nonlocal x
+        del x
+    g()
+    try:
+        print(x)
+        exit(1)
+    except UnboundLocalError:
+        pass
+k()
+
+# comprehension variables are captured by lambdas in the element
+def comp_rows(rows):
+    return [list(map(lambda v: v + r, [1, 2])) for r in rows]
+assert comp_rows([10, 20]) == [[11, 12], [21, 22]]
+
+def comp_last(x):
+    return [lambda: x + j for j in range(2)][1]()
+assert comp_last(5) == 6
+
+def comp_dict(x):
+    return {j: (lambda: j * x) for j in range(3)}[2]()
+assert comp_dict(4) == 8
+
+# a deleted free variable falls back to the global scope
+closure_global = 7
+def del_outer():
+    closure_global = 1
+    def inner():
+        return closure_global
+    del closure_global
+    return inner()
+assert del_outer() == 7
+
+def del_missing():
+    missing_name = 1
+    def inner():
+        return missing_name
+    del missing_name
+    return inner()
+try:
+    del_missing()
+    exit(1)
+except NameError:
+    pass
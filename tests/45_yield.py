@@ -64,4 +64,54 @@ try:
 except ValueError:
     pass
 
-assert next(t) == StopIteration
\ No newline at end of file
+assert next(t) == StopIteration
+# generators resumed by for loops, mixed with next()
+def f(n):
+    s = 0
+    for i in range(n):
+        try:
+            s += i
+            yield s
+        except KeyError:
+            pass
+    yield -1
+
+t = f(5)
+a = []
+for x in t:
+    a.append(x)
+    if x == 3:
+        break
+assert a == [0, 1, 3]
+assert next(t) == 6
+assert list(t) == [10, -1]
+assert next(t) == StopIteration
+for x in t:
+    exit(1)
+
+def g(it):
+    for x in it:
+        if x == 3:
+            raise ValueError(x)
+        yield x
+
+t = g(f(5))
+a = []
+try:
+    for x in t:
+        a.append(x)
+    exit(1)
+except ValueError:
+    pass
+assert a == [0, 1]
+assert next(t) == StopIteration
+
+# a long chain of generators does not grow the C stack
+def wrap(it):
+    for x in it:
+        yield x
+
+t = range(10)
+for i in range(5000):
+    t = wrap(t)
+assert sum(list(t)) == 45
@@ -13,4 +13,10 @@ assert getattr(1, '__add__')(2) == 3
 a = object()
 setattr(a, 'b', 1)
 assert a.b == 1
-assert getattr(a, 'b') == 1
\ No newline at end of file
+assert getattr(a, 'b') == 1
+# more than 65535 distinct names
+for i in range(70000):
+    setattr(a, 'name_' + str(i), i)
+assert getattr(a, 'name_69999') == 69999
+exec('def f(x):\n    return x.name_69998')
+assert f(a) == 69998
@@ -41,4 +41,21 @@ insort_right(a, 5)
 assert a == [0, 0, 1, 1, 1, 2, 5, 5, 6, 7, 8, 16, 22, 23, 23]
 
 insort_right(a, 1)
-assert a == [0, 0, 1, 1, 1, 1, 2, 5, 5, 6, 7, 8, 16, 22, 23, 23]
\ No newline at end of file
+assert a == [0, 0, 1, 1, 1, 1, 2, 5, 5, 6, 7, 8, 16, 22, 23, 23]
+from bisect import bisect, insort
+
+# lo and hi bound the searched slice
+a = [1, 2, 2, 2, 3]
+assert bisect_left(a, 2, 2) == 2
+assert bisect_right(a, 2, 0, 2) == 2
+assert bisect(a, 2) == 4
+assert bisect_left((1, 2, 2, 3), 2) == 1
+
+insort(a, 2)
+assert a == [1, 2, 2, 2, 2, 3]
+
+try:
+    bisect_left(a, 1, -1)
+    exit(1)
+except ValueError:
+    pass
@@ -41,4 +41,94 @@ assert not all([True, False])
 assert not all([False, False])
 
 assert list(enumerate([1,2,3])) == [(0,1), (1,2), (2,3)]
-assert list(enumerate([1,2,3], 1)) == [(1,1), (2,2), (3,3)]
\ No newline at end of file
+assert list(enumerate([1,2,3], 1)) == [(1,1), (2,2), (3,3)]
+# map, filter, zip, enumerate and reversed are lazy
+a = map(lambda x: x * 2, [1, 2, 3])
+assert next(a) == 2
+assert list(a) == [4, 6]
+assert list(map(str, range(3))) == ['0', '1', '2']
+assert list(filter(lambda x: x % 2, range(6))) == [1, 3, 5]
+assert list(filter(None, [0, 1, '', 'a', None, []])) == [1, 'a']
+assert list(zip([1, 2, 3], 'ab')) == [(1, 'a'), (2, 'b')]
+assert list(zip([1, 2], [3, 4], [5, 6])) == [(1, 3, 5), (2, 4, 6)]
+assert list(zip([1, 2])) == [(1,), (2,)]
+assert list(zip()) == []
+assert list(enumerate('ab', start=5)) == [(5, 'a'), (6, 'b')]
+assert list(reversed(range(4))) == [3, 2, 1, 0]
+assert list(reversed({1: 2, 3: 4})) == [3, 1]
+
+a = [1, 2, 3, 4]
+b = reversed(a)
+assert next(b) == 4
+a.pop()
+assert list(b) == [3, 2, 1]
+
+def gen():
+    yield 1
+    yield 2
+    yield 3
+assert list(map(lambda x: x + 1, filter(lambda x: x != 2, gen()))) == [2, 4]
+assert isinstance(map(str, []), map)
+
+# sum, min and max
+assert sum([1, 2, 3]) == 6
+assert sum((1, 2.5)) == 3.5
+assert sum(range(101)) == 5050
+assert sum(range(10, 0, -3)) == 22
+assert sum([], 5) == 5
+assert sum([[1], [2]], []) == [1, 2]
+assert sum([True, True, 1]) == 3
+assert sum([2**62, 2**62]) == 2**63
+assert sum(gen()) == 6
+
+assert max([3, 1, 4, 1, 5]) == 5
+assert min([3, 1, 4, 1, 5]) == 1
+assert max(3, 7, 2) == 7
+assert min((2.5, -1.5, 0.0)) == -1.5
+assert max([1, 2.5, 2]) == 2.5
+assert max(range(10)) == 9
+assert min(range(10)) == 0
+assert max(range(10, 0, -3)) == 10
+assert min(range(10, 0, -3)) == 1
+assert max('abc', key=ord) == 'c'
+assert min(['bb', 'a', 'ccc'], key=len) == 'a'
+assert max([(1, 'a'), (1, 'b')], key=lambda x: x[0]) == (1, 'a')
+assert max(gen()) == 3
+
+try:
+    max([])
+    exit(1)
+except ValueError:
+    pass
+try:
+    min(range(0))
+    exit(1)
+except ValueError:
+    pass
+try:
+    max()
+    exit(1)
+except TypeError:
+    pass
+
+# python code run by these builtins may trigger a collection
+import gc
+class Num:
+    def __init__(self, x):
+        self.x = x
+    def __add__(self, other):
+        gc.collect()
+        return Num(self.x + other)
+    def __radd__(self, other):
+        return Num(other + self.x)
+
+def nums(n):
+    for i in range(n):
+        yield Num([i])
+
+assert sum([Num(1), 2, 3], 0).x == 6
+assert sum(range(4), Num(0)).x == 6
+assert max(nums(5), key=lambda v: (gc.collect(), v.x)[1]).x == [4]
+assert min(nums(5), key=lambda v: (gc.collect(), v.x)[1]).x == [0]
+assert [v.x for v in filter(lambda v: (gc.collect(), v.x[0] % 2)[1], nums(5))] == [[1], [3]]
+assert [(a.x, b) for a, b in zip(nums(2), map(lambda v: (gc.collect(), v)[1], ['a', 'b']))] == [([0], 'a'), ([1], 'b')]
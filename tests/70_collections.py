@@ -13,4 +13,72 @@ assert q.popleft() == 3
 assert q.pop() == 4
 
 assert len(q) == 2
-assert q == deque([1, 2])
\ No newline at end of file
+assert q == deque([1, 2])
+# deque is a ring buffer, test wrapping around its ends
+q = deque()
+for i in range(100):
+    q.append(i)
+    q.appendleft(-i)
+assert len(q) == 200
+assert q[0] == -99 and q[-1] == 99
+for i in range(90):
+    q.pop()
+    q.popleft()
+assert list(q) == list(range(-9, 1)) + list(range(10))
+
+q = deque([1, 2, 3, 4, 5])
+q.rotate(2)
+assert q == deque([4, 5, 1, 2, 3])
+q.rotate(-3)
+assert q == deque([2, 3, 4, 5, 1])
+q[0] = 0
+del q[-1]
+assert q == deque([0, 3, 4, 5])
+q.insert(1, 1)
+q.remove(4)
+assert q == deque([0, 1, 3, 5])
+assert 3 in q and 2 not in q
+assert q.index(5) == 3
+q.extendleft([-1, -2])
+assert q == deque([-2, -1, 0, 1, 3, 5])
+q.reverse()
+assert repr(q) == 'deque([5, 3, 1, 0, -1, -2])'
+assert q.count(1) == 1
+
+try:
+    deque().pop()
+    exit(1)
+except IndexError:
+    pass
+
+# maxlen drops items from the opposite end
+q = deque(range(10), maxlen=3)
+assert q == deque([7, 8, 9])
+assert q.maxlen == 3
+q.appendleft(6)
+assert q == deque([6, 7, 8])
+assert repr(q) == 'deque([6, 7, 8], maxlen=3)'
+
+try:
+    for x in q:
+        q.append(x)
+    exit(1)
+except RuntimeError:
+    pass
+
+# clear() shrinks the buffer, and the deque stays usable
+for _ in range(50):
+    q = deque(range(1000))
+    q.clear()
+    assert len(q) == 0
+    assert q == deque()
+for i in range(100):
+    q.append(i)
+    q.appendleft(-i)
+assert len(q) == 200
+assert q.pop() == 99
+assert q.popleft() == -99
+q.clear()
+q.append(1)
+assert q.popleft() == 1
+assert len(q) == 0
@@ -38,4 +38,78 @@ f()
 
 assert os.path.exists('123.bin')
 os.remove('123.bin')
-assert not os.path.exists('123.bin')
\ No newline at end of file
+assert not os.path.exists('123.bin')
+# line by line
+with open('123.txt', 'w') as f:
+    f.write('a\nbb\n测试\nlast')
+
+with open('123.txt') as f:
+    assert f.readline() == 'a\n'
+    assert f.readline() == 'bb\n'
+    assert f.readline() == '测试\n'
+    assert f.readline() == 'last'
+    assert f.readline() == ''
+
+with open('123.txt') as f:
+    assert f.readlines() == ['a\n', 'bb\n', '测试\n', 'last']
+
+lines = []
+with open('123.txt') as f:
+    for line in f:
+        lines.append(line)
+assert lines == ['a\n', 'bb\n', '测试\n', 'last']
+
+# read(n) counts chars in text mode and bytes in binary mode
+with open('123.txt') as f:
+    assert f.read(3) == 'a\nb'
+    assert f.read(4) == 'b\n测试'
+    assert f.read() == '\nlast'
+    assert f.read(1) == ''
+
+with open('123.txt', 'rb') as f:
+    assert f.read(2) == b'a\n'
+    assert f.tell() == 2
+    f.seek(5)
+    assert f.read(3) == '测'.encode()
+    f.seek(-4, 2)
+    assert f.read() == b'last'
+    f.seek(0)
+    f.readline()
+    f.seek(1, 1)
+    assert f.read(1) == b'b'
+    assert f.tell() == 4
+
+f = open('123.txt')
+assert not f.closed
+f.close()
+assert f.closed
+try:
+    f.read()
+    exit(1)
+except ValueError:
+    pass
+
+# many small writes and a large one
+with open('123.txt', 'w') as f:
+    for i in range(10000):
+        f.write(str(i) + '\n')
+    assert f.tell() == 48890
+    f.write('x' * 100000)
+
+with open('123.txt') as f:
+    i = 0
+    for line in f:
+        if i < 10000:
+            assert line == str(i) + '\n'
+        i += 1
+    assert i == 10001
+    assert f.tell() == 148890
+
+with open('123.txt', 'r+') as f:
+    assert f.read(5) == '0\n1\n2'
+    f.seek(f.tell())
+    f.write('X')
+    f.seek(0)
+    assert f.read(8) == '0\n1\n2X3\n'
+
+os.remove('123.txt')
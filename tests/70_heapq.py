@@ -6,4 +6,26 @@ b = sorted(a)
 
 heapify(a)
 for x in b:
-    assert heappop(a) == x
\ No newline at end of file
+    assert heappop(a) == x
+from heapq import heapreplace, heappushpop
+
+a = []
+for x in [5, 3, 8, 1, 9, 2]:
+    heappush(a, x)
+assert a[0] == 1
+assert heappushpop(a, 0) == 0
+assert heapreplace(a, 7) == 1
+assert [heappop(a) for _ in range(len(a))] == [2, 3, 5, 7, 8, 9]
+
+# items without a fast path compare with `__lt__`
+a = []
+for x in ['pear', 'apple', 'fig']:
+    heappush(a, (len(x), x))
+assert heappop(a) == (3, 'fig')
+assert heappop(a) == (4, 'pear')
+
+try:
+    heappop([])
+    exit(1)
+except IndexError:
+    pass
@@ -16,4 +16,96 @@ assert re.split(',','123,456,789,10') == ['123', '456', '789', '10']
 assert re.split(',',',123,456,789,10') == ['', '123', '456', '789', '10']
 assert re.split(',','123,456,789,10,') == ['123', '456', '789', '10']
 
-assert re.match('1','1') is not None
\ No newline at end of file
+assert re.match('1','1') is not None
+# test compile and Pattern
+p = re.compile(r'(\w+)@(\w+)\.com')
+assert p.pattern == r'(\w+)@(\w+)\.com'
+assert re.compile(p) is p
+m = p.search('mail: bob@example.com!')
+assert m.span() == (6, 21)
+assert m.group() == 'bob@example.com'
+assert m.groups() == ('bob', 'example')
+assert p.match('x bob@example.com') is None
+assert p.match('x bob@example.com', 2).group(1) == 'bob'
+assert p.fullmatch('bob@example.comx') is None
+assert p.findall('a@b.com, c@d.com') == [('a', 'b'), ('c', 'd')]
+assert re.findall(r'\d+', 'a1b22c333') == ['1', '22', '333']
+assert [m.group(0) for m in re.finditer(r'\d+', 'a1b22')] == ['1', '22']
+assert re.sub(r'\d', '#', 'a1b2c3', 2) == 'a#b#c3'
+assert re.search('(a)|(b)', 'b').groups() == (None, 'b')
+
+# compiled patterns are cached
+assert re.compile('abc') is re.compile('abc')
+for i in range(1000):
+    assert re.match(str(i), str(i)) is not None
+assert len(re._cache) <= 512
+
+# entries that are not compiled patterns are ignored
+re._cache['abc'] = 'not a pattern'
+assert re.match('abc', 'abcd').span() == (0, 3)
+re._cache = None
+assert re.search('b', 'ab').span() == (1, 2)
+assert type(re._cache) is dict
+del re._cache
+re.purge()
+assert len(re._cache) == 0
+
+# the engine runs in linear time
+assert re.match('(a*)*b', 'a' * 10000) is None
+assert re.search('(x+x+)+y', 'x' * 10000) is None
+assert re.fullmatch('(a|aa)*', 'a' * 10000) is not None
+assert len(re.findall('[ab]*a[ab]{14}b', 'ab' * 5000)) == 1
+
+assert re.match('a|ab', 'ab').group() == 'a'
+assert re.fullmatch('a|ab', 'ab').group() == 'ab'
+assert re.match('a+?', 'aaa').group() == 'a'
+assert re.search('<.*?>', 'x<a><b>').group() == '<a>'
+assert re.fullmatch('a{2,3}', 'aaa') is not None
+assert re.fullmatch('a{2,3}', 'aaaa') is None
+assert re.match('a{,2}', 'a{,2}').group() == 'a{,2}'
+assert re.findall(r'[^\d\s]+', 'ab 12 c3') == ['ab', 'c']
+assert re.findall(r'\bb\w*', 'bar abc b') == ['bar', 'b']
+assert re.findall(r'\Bb', 'bar abc b') == ['b']
+assert re.compile('^b').search('ab', 1) is None
+assert re.compile('b$').search('ab', 1).span() == (1, 2)
+assert re.search('(a)(x)?', 'ba').groups() == ('a', None)
+assert re.match('.', '测试').group() == '测'
+assert re.findall('[测试]+', 'a测b试测c') == ['测', '试测']
+
+# empty matches next to the previous match
+assert re.sub('x*', '-', 'abxd') == '-a-b--d-'
+assert re.findall('x*', 'abxd') == ['', '', 'x', '', '']
+assert re.sub(r'(\w)(\d)', '$2$1', 'a1b2') == '1a2b'
+assert re.sub(r'\d+', '<$&>', 'a12b3') == 'a<12>b<3>'
+
+# an iteration which matches the empty string ends the loop
+assert re.search('(?:.{0,2}?)*', 'c bba 1x').span() == (0, 0)
+assert re.search('(?:(a?)|.)+', 'bac1ccc').span() == (0, 0)
+assert re.match('(a*)*', 'b').groups() == ('',)
+assert re.match('(a|)*', 'aab').span() == (0, 2)
+assert re.search('((?:|b?){0,2}a*)*.{0,2}', 'abbccabc').span() == (0, 3)
+assert re.search('(.*?){0,2}a?c+', 'bccbbab').groups() == ('',)
+
+# lookaheads run once per position
+assert re.search(r'a(?=b)', 'acab').span() == (2, 3)
+assert re.search('a(?!b)', 'abac').span() == (2, 3)
+assert re.search(r'(?=(\w+))\w', 'abc').groups() == ('abc',)
+assert re.findall('(?=(aa))', 'aaaa') == ['aa', 'aa', 'aa']
+assert re.search('(x+x+)+(?=y)', 'x'*28) is None
+assert re.search('(?:a|b)*(?=c)', 'ab'*200000+'c').span() == (0, 400000)
+
+# backreferences have a step limit
+assert re.match(r'(a+)b\1', 'aabaa').group() == 'aabaa'
+assert re.search(r'(\w+) \1', 'hello foo foo bar').groups() == ('foo',)
+try:
+    re.search(r'(x+x+)+\1y', 'x'*40)
+    exit(1)
+except RuntimeError:
+    pass
+
+for p in ['a**', '(', 'a)', '[a', 'a{2,1}', r'\q', '*']:
+    try:
+        re.compile(p)
+        exit(1)
+    except ValueError:
+        pass
@@ -9,4 +9,88 @@ gc.collect()
 
 create_garbage()
 create_garbage()
-create_garbage()
\ No newline at end of file
+create_garbage()
+# generations
+thresholds = gc.get_threshold()
+gc.set_threshold(100, 100000)
+assert gc.get_threshold() == (100, 100000)
+
+class Node:
+    pass
+
+old_list = []
+old_slot = [None]
+old_dict = {}
+old_node = Node()
+gc.collect()        # now they are old
+young, old = gc.get_count()
+assert old > 0
+
+# old containers referencing young objects must survive minor collections
+for i in range(1000):
+    old_list.append([i])
+    old_slot[0] = ['x', i]
+    old_dict[i] = (i, str(i))
+    old_node.value = [i, i]
+gc.collect(0)
+gc.collect(0)
+
+assert old_list[999] == [999]
+assert old_slot[0] == ['x', 999]
+assert old_dict[500] == (500, '500')
+assert old_node.value == [999, 999]
+
+stats = gc.get_stats()
+assert len(stats) == 2
+assert stats[0]['collections'] > 0
+assert stats[1]['collections'] > 0
+assert stats[0]['pause_max_us'] >= 0
+
+gc.set_threshold(*thresholds)
+
+# incremental mode
+assert not gc.is_incremental()
+gc.set_incremental(1000)
+assert gc.is_incremental()
+
+def test_incremental():
+    # scanned nodes get references from unscanned lists while marking
+    root = [[[[i, str(i)]] for i in range(3000)], [Node() for i in range(300)]]
+    gc.collect()
+    cycles = 0
+    for i in range(300):
+        root[1][i].value = root[0].pop(0).pop()
+        if gc.step(0):
+            cycles += 1
+    while not gc.step(0):
+        pass
+    assert cycles > 0
+    for node in root[1]:
+        assert node.value[1] == str(node.value[0])
+
+test_incremental()
+
+held = None
+def test_incremental_roots():
+    # values only referenced by locals and globals, which have no write barriers
+    global held
+    data = [[i, str(i)] for i in range(2000)]
+    gc.collect()
+    kept = None
+    while data:
+        kept = data.pop()
+        held = data.pop()
+        gc.step(0)
+        assert kept[1] == str(kept[0])
+        assert held[1] == str(held[0])
+    while not gc.step(0):
+        pass
+    assert kept[1] == str(kept[0])
+    assert held[1] == str(held[0])
+
+test_incremental_roots()
+assert gc.collect(0) >= 0
+
+gc.set_incremental(0)
+assert not gc.is_incremental()
+assert gc.step(100) == True
@@ -64,4 +64,34 @@ assert repr([1, 2, 3]) == '[1, 2, 3]'
 assert repr([1]) == '[1]'
 assert json.dumps([]) == '[]'
 assert json.dumps([1, 2, 3]) == '[1, 2, 3]'
-assert json.dumps([1]) == '[1]'
\ No newline at end of file
+assert json.dumps([1]) == '[1]'
+# strings and escapes
+assert json.loads('"a\\"b\\\\c\\/d\\n\\t"') == 'a"b\\c/d\n\t'
+assert json.loads('"\\u00e9\\ud83d\\ude00"') == 'é😀'
+assert json.dumps('a"b\\c\n\x01') == '"a\\"b\\\\c\\n\\u0001"'
+assert json.loads(json.dumps('line\r\nnext\ttab')) == 'line\r\nnext\ttab'
+
+# numbers
+assert json.loads('-0.25e2') == -25.0
+assert json.loads('123456789012345678901234567890') == 123456789012345678901234567890
+assert json.dumps(0.1) == '0.1'
+assert json.dumps([1.0, -2.5]) == '[1.0, -2.5]'
+
+assert json.loads(' { "a" : [ 1 , {} ] } ') == {'a': [1, {}]}
+assert json.loads(b'[1, "x"]') == [1, 'x']
+assert json.dumps({'a': (1, None)}) == '{"a": [1, null]}'
+
+for bad in ['', '[1,]', '{"a" 1}', '[1 2]', '"abc', 'tru', '01', "{'a': 1}", '"\\x"', '1 2']:
+    try:
+        json.loads(bad)
+        exit(1)
+    except ValueError:
+        pass
+
+a = [1]
+a.append(a)
+try:
+    json.dumps(a)
+    exit(1)
+except ValueError:
+    pass
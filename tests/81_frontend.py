@@ -1,4 +1,4 @@
-from dis import dis, _s
+from dis import dis, _s, _ops
 
 def f(a):
     for i in range(100000):
@@ -14,4 +14,128 @@ def g(a):
     return f([1,2,3] + a)
 
 x = _s(g)
-assert type(x) is str
\ No newline at end of file
+assert type(x) is str
+# constant folding
+def folded(r):
+    return 2 * 3.5 * r, -(-3), 7 // 2, 7 % 3, 1 / 4, 'a' + 'b', (1, (2, None), 'x'), 6 & 3 | 8
+
+assert folded(2) == (14.0, 3, 3, 1, 0.25, 'ab', (1, (2, None), 'x'), 10)
+assert -7 // 2 == (lambda a, b: a // b)(-7, 2)
+assert -7 % 2 == (lambda a, b: a % b)(-7, 2)
+assert 2 ** 62 == (lambda a, b: a ** b)(2, 62)
+assert 65536 * 65536 * 65536 == (lambda a, b: a * b)(65536 * 65536, 65536)
+
+# executed code may have been quickened into typed variants
+def count_ops(f, prefix):
+    return len([op for op in _ops(f) if op.startswith(prefix)])
+
+assert count_ops(folded, 'BINARY_') == 1        # only `7.0 * r` is left
+assert count_ops(folded, 'BUILD_TUPLE') == 1    # the nested tuple is a constant
+assert count_ops(folded, 'UNARY_') == 0
+assert count_ops(folded, 'BITWISE_') == 0
+
+def partly_folded(x):
+    return ('a' + 'b') + x, (1, 'z', x), 'q' + 1
+
+ops = _ops(partly_folded)
+assert ops == ['LOAD_CONST', 'LOAD_FAST', 'BINARY_ADD',
+               'LOAD_INTEGER', 'LOAD_CONST', 'LOAD_FAST', 'BUILD_TUPLE',
+               'LOAD_CONST', 'LOAD_INTEGER', 'BINARY_ADD',
+               'BUILD_TUPLE', 'RETURN_VALUE'], ops
+try:
+    partly_folded('c')
+    exit(1)
+except TypeError:
+    pass
+
+# peephole optimizations
+def peephole(a, b):
+    if not a:
+        if not b:
+            return 0
+        else:
+            return 1
+    else:
+        while a:
+            a -= 1
+            if a == 2:
+                break
+        else:
+            return -1
+    return a, b
+    return None     # dead code
+
+assert peephole(0, 0) == 0
+assert peephole(0, 1) == 1
+assert peephole(1, 7) == -1
+assert peephole(5, 7) == (2, 7)
+
+assert count_ops(peephole, 'JUMP_ABSOLUTE') == 0   # jumps to returns are replaced
+assert count_ops(peephole, 'UNARY_NOT') == 0       # `if not x` jumps on the opposite condition
+assert count_ops(peephole, 'LOAD_NONE') == 0       # dead code is removed
+
+def after_return(x):
+    try:
+        return x[0]
+    except:
+        return None
+    x = 1
+
+assert after_return([1]) == 1
+assert after_return([]) is None
+
+# superinstructions
+class Vec:
+    def __init__(self, x):
+        self.x = x
+    def __lt__(self, other):
+        return self.x < other.x
+    def __le__(self, other):
+        return self.x <= other.x
+    def __eq__(self, other):
+        return isinstance(other, Vec) and self.x == other.x
+
+def fused(a, b):
+    res = []
+    if a < b: res.append('lt')
+    if a <= b: res.append('le')
+    if a > b: res.append('gt')
+    if a >= b: res.append('ge')
+    if a == b: res.append('eq')
+    if a != b: res.append('ne')
+    return res
+
+assert fused(1, 2) == ['lt', 'le', 'ne']
+assert fused(2.5, 2) == ['gt', 'ge', 'ne']
+assert fused('a', 'a') == ['le', 'ge', 'eq']
+assert fused(Vec(1), Vec(2)) == ['lt', 'le', 'ne']
+assert fused(Vec(3), Vec(2)) == ['gt', 'ge', 'ne']     # reflected
+assert fused(Vec(2), Vec(2)) == ['le', 'ge', 'eq']
+
+assert count_ops(fused, 'LOAD_FAST_LOAD_FAST') == 6
+for op in ['LT', 'LE', 'GT', 'GE', 'EQ', 'NE']:
+    assert count_ops(fused, 'COMPARE_' + op) == 1
+    assert count_ops(fused, 'COMPARE_' + op + '_JUMP_IF_FALSE') == 1
+assert count_ops(fused, 'POP_JUMP_IF_FALSE') == 0
+
+def count_down(n):
+    v = Vec(n)
+    while v.x > -3:
+        v.x = v.x - 1
+    return v.x, n + 1000, n - 32768
+
+assert count_down(2) == (-3, 1002, -32766)
+
+assert count_ops(count_down, 'LOAD_FAST_LOAD_ATTR') == 3
+assert count_ops(count_down, 'LOAD_FAST_LOAD_INTEGER') == 1
+
+def unbound_attr():
+    if False:
+        v = None
+    return v.x
+
+try:
+    unbound_attr()
+    exit(1)
+except UnboundLocalError:
+    pass
@@ -1057,6 +1057,33 @@ assert type(local_t.tm_isdst) is int
 # test time.sleep
 time.sleep(0.1)
 
+t0 = time.perf_counter()
+time.sleep(0.05)
+assert time.perf_counter() - t0 >= 0.04
+assert type(time.perf_counter_ns()) is int
+assert type(time.monotonic()) is float
+assert time.monotonic() <= time.monotonic()
+try:
+    time.sleep(-1)
+    exit(1)
+except ValueError:
+    pass
+try:
+    time.sleep(float('nan'))
+    exit(1)
+except ValueError:
+    pass
+try:
+    time.sleep(10.0**300)
+    exit(1)
+except OverflowError:
+    pass
+try:
+    time.sleep(float('inf'))
+    exit(1)
+except OverflowError:
+    pass
+
 # 未完全测试准确性-----------------------------------------------
 #       116: 1278:    vm->bind_func<0>(mod, "localtime", [](VM* vm, ArgsView args) {
 #     #####: 1279:        auto now = std::chrono::system_clock::now();